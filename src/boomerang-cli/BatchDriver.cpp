@@ -0,0 +1,161 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BatchDriver.h"
+
+#include "boomerang/util/log/Log.h"
+
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QSet>
+#include <QTimer>
+
+
+/// Switches added to the worker arguments when retrying a program whose worker failed.
+/// Type analysis and removal of unused returns are the passes most likely to not terminate.
+static const QStringList degradedArgs = { "-nT", "-nR" };
+
+
+BatchDriver::BatchDriver(const QStringList &workerArgs, const QDir &outputDir, int numWorkers,
+                         int minsPerProgram)
+    : m_workerArgs(workerArgs)
+    , m_outputDir(outputDir)
+    , m_numWorkers(std::max(numWorkers, 1))
+    , m_minsPerProgram(minsPerProgram)
+{
+}
+
+
+int BatchDriver::decompile(const QStringList &programs)
+{
+    m_numFailed = 0;
+
+    const QStringList outputDirNames = getOutputDirNames(programs);
+
+    for (int i = 0; i < programs.size(); ++i) {
+        m_pendingJobs.push_back({ programs[i], outputDirNames[i], false });
+    }
+
+    startPendingJobs();
+
+    // All workers may already have finished if they could not be started
+    if (m_numRunning > 0) {
+        m_eventLoop.exec();
+    }
+
+    LOG_MSG("Batch decompilation finished: %1 of %2 programs decompiled successfully.",
+            programs.size() - m_numFailed, programs.size());
+
+    return m_numFailed;
+}
+
+
+QStringList BatchDriver::getOutputDirNames(const QStringList &programs)
+{
+    QStringList dirNames;
+    QSet<QString> usedNames; // lower case, for case insensitive file systems
+
+    for (const QString &program : programs) {
+        const QString fileName = QFileInfo(program).fileName();
+        QString dirName        = fileName;
+
+        for (int i = 2; usedNames.contains(dirName.toLower()); ++i) {
+            dirName = QString("%1_%2").arg(fileName).arg(i);
+        }
+
+        usedNames.insert(dirName.toLower());
+        dirNames << dirName;
+    }
+
+    return dirNames;
+}
+
+
+void BatchDriver::startPendingJobs()
+{
+    while (!m_pendingJobs.empty() && m_numRunning < m_numWorkers) {
+        // Remove the job before starting it: If the worker fails to start, onJobFinished
+        // is called from within startJob and starts the next pending jobs itself.
+        const Job job = std::move(m_pendingJobs.front());
+        m_pendingJobs.pop_front();
+        startJob(job);
+    }
+}
+
+
+void BatchDriver::startJob(const Job &job)
+{
+    const QFileInfo inf(job.program);
+
+    QStringList args = m_workerArgs;
+    if (job.degraded) {
+        args << degradedArgs;
+    }
+
+    args << "-o" << m_outputDir.absoluteFilePath(job.outputDirName) + "/";
+    args << "--" << inf.absoluteFilePath();
+
+    QProcess *worker = new QProcess();
+    worker->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    worker->setStandardOutputFile(QProcess::nullDevice());
+
+    QObject::connect(worker, qOverload<int, QProcess::ExitStatus>(&QProcess::finished), worker,
+                     [this, job, worker]() {
+                         onJobFinished(job, worker, worker->property("timedOut").toBool());
+                     });
+
+    QObject::connect(worker, &QProcess::errorOccurred, worker,
+                     [this, job, worker](QProcess::ProcessError error) {
+                         // finished() is not emitted if the worker could not be started
+                         if (error == QProcess::FailedToStart) {
+                             onJobFinished(job, worker, false);
+                         }
+                     });
+
+    if (m_minsPerProgram > 0) {
+        QTimer::singleShot(1000 * 60 * m_minsPerProgram, worker, [worker]() {
+            worker->setProperty("timedOut", true);
+            worker->kill();
+        });
+    }
+
+    LOG_MSG("Decompiling '%1'%2", job.program, job.degraded ? " (reduced analysis)" : "");
+
+    m_numRunning++;
+    worker->start(QCoreApplication::applicationFilePath(), args);
+}
+
+
+void BatchDriver::onJobFinished(const Job &job, QProcess *worker, bool timedOut)
+{
+    const bool ok = worker->error() != QProcess::FailedToStart &&
+                    worker->exitStatus() == QProcess::NormalExit && worker->exitCode() == 0;
+
+    if (ok) {
+        LOG_MSG("Decompiled '%1'", job.program);
+    }
+    else if (!job.degraded && worker->error() != QProcess::FailedToStart) {
+        LOG_WARN("Decompiling '%1' %2, retrying with reduced analysis", job.program,
+                 timedOut ? "timed out" : "failed");
+        m_pendingJobs.push_back({ job.program, job.outputDirName, true });
+    }
+    else {
+        LOG_ERROR("Could not decompile '%1'", job.program);
+        m_numFailed++;
+    }
+
+    worker->deleteLater();
+    m_numRunning--;
+
+    startPendingJobs();
+
+    if (m_numRunning == 0) {
+        m_eventLoop.quit();
+    }
+}
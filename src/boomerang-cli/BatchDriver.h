@@ -0,0 +1,75 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#pragma once
+
+
+#include <QDir>
+#include <QEventLoop>
+#include <QProcess>
+#include <QStringList>
+
+#include <deque>
+
+
+/**
+ * Decompiles a list of programs by running one boomerang-cli worker process per program.
+ * A worker that crashes, fails or times out does not affect the other workers;
+ * its program is retried once with reduced analysis settings.
+ */
+class BatchDriver
+{
+public:
+    /**
+     * \param workerArgs     Switches passed to each worker (without output directory and program)
+     * \param outputDir      Each program is written to a sub directory of this directory
+     * \param numWorkers     Maximum number of concurrently running workers
+     * \param minsPerProgram Kill a worker after this many minutes (0 = no limit)
+     */
+    BatchDriver(const QStringList &workerArgs, const QDir &outputDir, int numWorkers,
+                int minsPerProgram);
+
+public:
+    /**
+     * Decompile all programs in \p programs and wait for all workers to finish.
+     * \returns the number of programs that could not be decompiled.
+     */
+    int decompile(const QStringList &programs);
+
+    /**
+     * Get the name of the output sub directory of each program in \p programs.
+     * The names are based on the file names of the programs and are unique
+     * (ignoring case), so programs with the same file name do not overwrite each other.
+     */
+    static QStringList getOutputDirNames(const QStringList &programs);
+
+private:
+    struct Job
+    {
+        QString program;
+        QString outputDirName; ///< Name of the output sub directory of this program
+        bool degraded = false; ///< true when retrying with reduced analysis settings
+    };
+
+    /// Start pending jobs until \ref m_numWorkers workers are running.
+    void startPendingJobs();
+    void startJob(const Job &job);
+    void onJobFinished(const Job &job, QProcess *worker, bool timedOut);
+
+private:
+    QStringList m_workerArgs;
+    QDir m_outputDir;
+    int m_numWorkers     = 1;
+    int m_minsPerProgram = 0;
+
+    QEventLoop m_eventLoop;
+    std::deque<Job> m_pendingJobs;
+    int m_numRunning = 0;
+    int m_numFailed  = 0;
+};
@@ -9,6 +9,8 @@
 #pragma endregion License
 #include "CommandlineDriver.h"
 
+#include "boomerang-cli/BatchDriver.h"
+
 #include "boomerang/core/Settings.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/util/CFGDotWriter.h"
@@ -16,6 +18,7 @@
 
 #include <QCoreApplication>
 #include <QTextStream>
+#include <QThread>
 
 #include <iostream>
 
@@ -42,6 +45,7 @@ static void help()
 "Usage:\n"
 "  boomerang-cli [ switches ] [ -- ] program\n"
 "  boomerang-cli -i [ command_file ]\n"
+"  boomerang-cli [ switches ] --batch <file>\n"
 "  boomerang-cli ( -h | --help | --version )\n"
 "\n"
 "\n"
@@ -73,6 +77,11 @@ static void help()
 "Misc.\n"
 "  -i [<file>]      : Interactive mode; execute commands from <file>, if present\n"
 "  -P <path>        : Path to Boomerang files, defaults to the path to the Boomerang executable\n"
+"  --batch <file>   : Decompile each program listed in <file> (one per line) in a separate\n"
+"                     process. Programs whose process fails or exceeds the -S limit are\n"
+"                     retried once with -nT -nR\n"
+"  -j <num>         : Number of programs to decompile concurrently with --batch\n"
+"                     (defaults to the number of processor cores)\n"
 "  --               : Terminates argument processing\n"
 "\n"
 "Debug\n"
@@ -224,6 +233,32 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
             m_project->getSettings()->setOutputDirectory(wd.path() + "/./output/");
             continue;
         }
+        else if (arg == "--batch") {
+            if (++i == args.size()) {
+                help();
+                return 1;
+            }
+
+            m_batchFile = args[i];
+            continue;
+        }
+        else if (arg == "-j") {
+            if (++i == args.size()) {
+                help();
+                return 1;
+            }
+
+            bool converted = false;
+            m_numWorkers   = args[i].toInt(&converted, 0);
+
+            if (!converted || m_numWorkers < 1) {
+                std::cerr << "'-j': Bad argument '" << args[i].toStdString() << "' (try --help)."
+                          << std::endl;
+                return 1;
+            }
+
+            continue;
+        }
         else if (arg == "-ic") {
             m_project->getSettings()->decodeThruIndCall = true;
             continue;
@@ -435,6 +470,25 @@ int CommandlineDriver::applyCommandline(const QStringList &args)
     if (interactiveMode) {
         return interactiveMain();
     }
+    else if (!m_batchFile.isEmpty()) {
+        if (!binaryPath.isEmpty()) {
+            help();
+            return 1;
+        }
+
+        // Everything except the batch switches and the output directory is passed to the workers
+        for (int i = 1; i < args.size(); ++i) {
+            if (args[i] == "--batch" || args[i] == "-j" || args[i] == "-o") {
+                ++i;
+            }
+            else {
+                m_batchWorkerArgs << args[i];
+            }
+        }
+
+        // The time limit is enforced for each worker separately
+        return 0;
+    }
     else if (binaryPath == "") {
         help();
         return 1;
@@ -488,6 +542,11 @@ int CommandlineDriver::decompile()
 {
     Log::getOrCreateLog().addDefaultLogSinks(
         m_project->getSettings()->getOutputDirectory().absolutePath());
+
+    if (!m_batchFile.isEmpty()) {
+        return decompileBatch();
+    }
+
     m_project->loadPlugins();
 
     QDir wd       = m_project->getSettings()->getWorkingDirectory();
@@ -497,6 +556,34 @@ int CommandlineDriver::decompile()
 }
 
 
+int CommandlineDriver::decompileBatch()
+{
+    QDir wd = m_project->getSettings()->getWorkingDirectory();
+    QFile batchFile(wd.absoluteFilePath(m_batchFile));
+
+    if (!batchFile.open(QFile::ReadOnly | QFile::Text)) {
+        LOG_ERROR("Cannot read batch file '%1'", batchFile.fileName());
+        return 1;
+    }
+
+    QStringList programs;
+    QTextStream ist(&batchFile);
+
+    while (!ist.atEnd()) {
+        const QString line = ist.readLine().trimmed();
+        if (!line.isEmpty()) {
+            programs << wd.absoluteFilePath(line);
+        }
+    }
+
+    const int numWorkers = m_numWorkers > 0 ? m_numWorkers : QThread::idealThreadCount();
+    BatchDriver batch(m_batchWorkerArgs, m_project->getSettings()->getOutputDirectory(),
+                      numWorkers, minsToStopAfter);
+
+    return batch.decompile(programs) == 0 ? 0 : 1;
+}
+
+
 void CommandlineDriver::onCompilationTimeout()
 {
     LOG_WARN("Compilation timed out, Boomerang will now exit");
@@ -51,6 +51,9 @@ public:
 
     const Project *getProject() const { return m_project.get(); }
 
+    /// \returns the switches passed on to each worker process in batch mode (--batch)
+    const QStringList &getBatchWorkerArgs() const { return m_batchWorkerArgs; }
+
 private:
     /**
      * Loads the executable file and decodes it.
@@ -70,6 +73,12 @@ private:
      */
     int decompile(const QString &fname, const QString &pname);
 
+    /**
+     * Decompile all programs listed in the batch file, each in a separate worker process.
+     * \returns Zero if all programs were decompiled, non-zero otherwise.
+     */
+    int decompileBatch();
+
 public slots:
     void onCompilationTimeout();
 
@@ -80,4 +89,8 @@ private:
     QTimer m_kill_timer;
     int minsToStopAfter = 0;
     QString m_pathToBinary;
+
+    QString m_batchFile;           ///< List of programs to decompile (--batch)
+    QStringList m_batchWorkerArgs; ///< Switches passed on to each batch worker process
+    int m_numWorkers = 0;          ///< Number of concurrent batch workers (-j), 0 = auto
 };
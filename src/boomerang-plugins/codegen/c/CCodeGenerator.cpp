@@ -11,8 +11,11 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
+#include "boomerang/db/Global.h"
 #include "boomerang/db/IRFragment.h"
 #include "boomerang/db/Prog.h"
+#include "boomerang/db/binary/BinaryImage.h"
+#include "boomerang/db/binary/BinarySection.h"
 #include "boomerang/db/module/Module.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/db/signature/Signature.h"
@@ -44,6 +47,65 @@
 #define BELSE 1
 
 
+/**
+ * Writes the digits of \p value in base \p base (at most 16, lower case) to \p first.
+ * \returns a pointer past the last character written.
+ */
+static char *formatUnsigned(char *first, QWord value, unsigned int base)
+{
+    char digits[64]; // enough for any 64 bit value in base 2 or above
+    int numDigits = 0;
+
+    do {
+        digits[numDigits++] = "0123456789abcdef"[value % base];
+        value /= base;
+    } while (value != 0);
+
+    while (numDigits > 0) {
+        *first++ = digits[--numDigits];
+    }
+
+    return first;
+}
+
+
+/**
+ * Formats the integer constant \p value to \p first the same way
+ * \ref CCodeGenerator::appendExp does for integer constants that are not characters.
+ * The buffer must be able to hold at least 12 characters.
+ * \returns a pointer past the last character written.
+ */
+static char *formatIntConst(char *first, int value, bool uns)
+{
+    if (uns && (value < 0)) {
+        // An unsigned constant. Use some heuristics
+        const unsigned int uval = static_cast<unsigned int>(value);
+        const unsigned int rem  = uval % 100;
+
+        if ((rem == 0) || (rem == 99) || (value > -128)) {
+            // A multiple of 100, or one less; use 4000000000U style
+            char *end = formatUnsigned(first, uval, 10);
+            *end++    = 'U';
+            return end;
+        }
+    }
+    else if ((-2048 < value) && (value < 2048)) {
+        // Just a plain vanilla int
+        if (value < 0) {
+            *first++ = '-';
+            return formatUnsigned(first, static_cast<QWord>(-value), 10);
+        }
+
+        return formatUnsigned(first, static_cast<QWord>(value), 10);
+    }
+
+    // Output it in 0xF0000000 style
+    *first++ = '0';
+    *first++ = 'x';
+    return formatUnsigned(first, static_cast<uint32_t>(value), 16);
+}
+
+
 CCodeGenerator::CCodeGenerator(Project *project)
     : ICodeGenerator(project)
 {
@@ -74,6 +136,13 @@ void CCodeGenerator::generateCode(const Prog *prog, Module *cluster, UserProc *p
             const bool global = !prog->getGlobals().empty();
 
             for (auto &elem : prog->getGlobals()) {
+                // Large integer arrays are emitted straight from the image
+                InitialIntArray array;
+                if (elem->getInitialIntArray(array)) {
+                    addGlobalIntArray(elem->getName(), elem->getType(), array);
+                    continue;
+                }
+
                 // Check for an initial value
                 SharedExp e = elem->getInitialValue();
                 // if (e) {
@@ -472,18 +541,25 @@ void CCodeGenerator::generateDataSectionCode(const BinaryImage *image, QString s
               Const::get(section_start));
     addGlobal(section_name + "_size", IntegerType::get(32, Sign::Unsigned),
               Const::get(size ? size : static_cast<uint32_t>(-1)));
-    auto l = Terminal::get(opNil);
 
-    for (unsigned int i = 0; i < size; i++) {
-        Byte value = 0;
-        if (!image->readNative1(section_start + size - 1 - i, value)) {
-            break;
-        }
+    SharedType type              = ArrayType::get(IntegerType::get(8, Sign::Unsigned), size);
+    const BinarySection *section = image->getSectionByAddr(section_start);
 
-        l = Binary::get(opList, Const::get(value & 0xFF), l);
+    if (size == 0 || !section || section->getHostAddr() == HostAddress::INVALID ||
+        section_start + size > section->getSourceAddr() + section->getSize()) {
+        addGlobal(section_name, type);
+        return;
     }
 
-    addGlobal(section_name, ArrayType::get(IntegerType::get(8, Sign::Unsigned), size), l);
+    // Read the section contents in one go instead of byte by byte
+    InitialIntArray array;
+    array.data = reinterpret_cast<const Byte *>(
+        (section->getHostAddr() - section->getSourceAddr() + section_start).value());
+    array.numElements = size;
+    array.elementSize = 1;
+    array.endian      = section->getEndian();
+
+    addGlobalIntArray(section_name, type, array);
 }
 
 
@@ -974,6 +1050,66 @@ void CCodeGenerator::addGlobal(const QString &name, SharedType type, const Share
 }
 
 
+void CCodeGenerator::addGlobalIntArray(const QString &name, SharedType type,
+                                       const InitialIntArray &init)
+{
+    QString tgt;
+    OStream s(&tgt);
+
+    SharedType baseType = type->as<ArrayType>()->getBaseType();
+    appendType(s, baseType);
+
+    s << " " << name << "[";
+    if (!type->as<ArrayType>()->isUnbounded()) {
+        s << type->as<ArrayType>()->getLength();
+    }
+    s << "]";
+
+    if (init.numElements > 0) {
+        const bool uns = baseType->isInteger() ? baseType->as<IntegerType>()->isUnsigned() : false;
+
+        // Format all elements into a single buffer. Same layout as an opList in appendExp.
+        QByteArray initText;
+        initText.reserve(init.numElements * 5 + 4);
+        initText.append(" = { ");
+
+        char num[16];
+        int elemsOnLine = 0;
+
+        for (int i = 0; i < init.numElements; i++) {
+            const Byte *elem = init.data + i * init.elementSize;
+            int value        = 0;
+
+            switch (init.elementSize) {
+            case 1: value = Util::readByte(elem); break;
+            case 2: value = Util::readWord(elem, init.endian); break;
+            case 4: value = static_cast<int>(Util::readDWord(elem, init.endian)); break;
+            default: assert(false); break;
+            }
+
+            initText.append(num, formatIntConst(num, value, uns) - num);
+
+            if (i == init.numElements - 1) {
+                break;
+            }
+            else if (++elemsOnLine >= 16) {
+                initText.append(",\n ");
+                elemsOnLine = 0;
+            }
+            else {
+                initText.append(", ");
+            }
+        }
+
+        initText.append(" }");
+        s << QString::fromLatin1(initText.constData(), initText.size());
+    }
+
+    s << ";";
+    appendLine(tgt);
+}
+
+
 void CCodeGenerator::addLineComment(const QString &cmt)
 {
     appendLine(QString("/* %1 */").arg(cmt));
@@ -988,50 +1124,29 @@ void CCodeGenerator::appendExp(OStream &str, const SharedConstExp &exp, OpPrec c
     switch (op) {
     case opIntConst: {
         const Const &constExp = *exp->access<Const>();
-        int K                 = constExp.getInt();
-
-        if (uns && (K < 0)) {
-            // An unsigned constant. Use some heuristics
-            unsigned rem = static_cast<unsigned int>(K) % 100;
-
-            if ((rem == 0) || (rem == 99) || (K > -128)) {
-                // A multiple of 100, or one less; use 4000000000U style
-                char num[16];
-                sprintf(num, "%u", static_cast<unsigned int>(K));
-                str << num << "U";
-            }
-            else {
-                // Output it in 0xF0000000 style
-                str << "0x" << QString::number(uint32_t(K), 16);
+        const int K           = constExp.getInt();
+
+        if (!(uns && (K < 0)) && constExp.getType() && constExp.getType()->isChar()) {
+            switch (K) {
+            case '\a': str << "'\\a'"; break;
+            case '\b': str << "'\\b'"; break;
+            case '\f': str << "'\\f'"; break;
+            case '\n': str << "'\\n'"; break;
+            case '\r': str << "'\\r'"; break;
+            case '\t': str << "'\\t'"; break;
+            case '\v': str << "'\\v'"; break;
+            case '\\': str << "'\\\\'"; break;
+            case '\?': str << "'\\?'"; break;
+            case '\'': str << "'\\''"; break;
+            case '\"': str << "'\\\"'"; break;
+            case 0: str << "0"; break;
+            default: str << "'" << static_cast<char>(K) << "'";
             }
         }
         else {
-            if (constExp.getType() && constExp.getType()->isChar()) {
-                switch (K) {
-                case '\a': str << "'\\a'"; break;
-                case '\b': str << "'\\b'"; break;
-                case '\f': str << "'\\f'"; break;
-                case '\n': str << "'\\n'"; break;
-                case '\r': str << "'\\r'"; break;
-                case '\t': str << "'\\t'"; break;
-                case '\v': str << "'\\v'"; break;
-                case '\\': str << "'\\\\'"; break;
-                case '\?': str << "'\\?'"; break;
-                case '\'': str << "'\\''"; break;
-                case '\"': str << "'\\\"'"; break;
-                case 0: str << "0"; break;
-                default: str << "'" << static_cast<char>(K) << "'";
-                }
-            }
-            else {
-                // More heuristics
-                if ((-2048 < K) && (K < 2048)) {
-                    str << K; // Just a plain vanilla int
-                }
-                else {
-                    str << "0x" << QString::number(uint32_t(K), 16); // 0x2000 style
-                }
-            }
+            char num[16];
+            *formatIntConst(num, K, uns) = '\0';
+            str << num;
         }
 
         break;
@@ -1042,7 +1157,9 @@ void CCodeGenerator::appendExp(OStream &str, const SharedConstExp &exp, OpPrec c
         // str << std::dec << c->getLong() << "LL"; break;
         if ((static_cast<long long>(constExp.getLong()) < -1000LL) ||
             (constExp.getLong() > 1000ULL)) {
-            str << "0x" << QString::number(constExp.getLong(), 16) << "LL";
+            char num[24];
+            *formatUnsigned(num, constExp.getLong(), 16) = '\0';
+            str << "0x" << num << "LL";
         }
         else {
             str << constExp.getLong() << "LL";
@@ -2674,7 +2791,15 @@ void CCodeGenerator::print(const Module *module)
 
 void CCodeGenerator::indent(OStream &str, int indLevel)
 {
-    str << QString(4 * indLevel, ' ');
+    if (indLevel <= 0) {
+        return;
+    }
+
+    while (static_cast<int>(m_indentStrings.size()) <= indLevel) {
+        m_indentStrings.emplace_back(4 * static_cast<int>(m_indentStrings.size()), ' ');
+    }
+
+    str << m_indentStrings[indLevel];
 }
 
 
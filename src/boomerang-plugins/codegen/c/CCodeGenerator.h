@@ -24,6 +24,7 @@
 #include <list>
 #include <map>
 #include <unordered_set>
+#include <vector>
 
 
 class IRFragment;
@@ -33,6 +34,7 @@ class BinaryImage;
 class Statement;
 
 struct SwitchInfo;
+struct InitialIntArray;
 
 /// Operator precedence
 /**
@@ -247,6 +249,15 @@ private:
      */
     void addGlobal(const QString &name, SharedType type, const SharedExp &init = nullptr);
 
+    /**
+     * Add the declaration for a global array of integers, with the initial values
+     * read directly from the binary image.
+     * \param name given name for the global
+     * \param type The (array) type of the global
+     * \param init The raw initial data of the global.
+     */
+    void addGlobalIntArray(const QString &name, SharedType type, const InitialIntArray &init);
+
     /// Adds one line of comment to the code.
     void addLineComment(const QString &cmt);
 
@@ -333,6 +344,9 @@ private:
     /// Current indentation depth
     int m_indent = 0;
 
+    /// Indentation strings by level, so indenting does not allocate a new string every line.
+    std::vector<QString> m_indentStrings;
+
     /// All used goto labels. (lowAddr of fragment)
     std::unordered_set<Address::value_type> m_usedLabels;
     std::unordered_set<const IRFragment *> m_generatedFrags;
@@ -16,21 +16,52 @@
 
 CodeWriter::WriteDest::WriteDest(const QString &outFileName)
     : m_outFile(outFileName)
-    , m_os(&m_outFile)
 {
     if (!m_outFile.open(QFile::WriteOnly | QFile::Text)) {
         throw std::runtime_error("Could not open file!");
     }
+
+    m_buffer.reserve(64 * 1024);
 }
 
 
 CodeWriter::CodeWriter::WriteDest::~WriteDest()
 {
-    m_os.flush();
     m_outFile.close();
 }
 
 
+bool CodeWriter::WriteDest::writeLines(const QStringList &lines)
+{
+    // Capacity was reserved in the constructor, so this does not free the buffer.
+    m_buffer.resize(0);
+
+    for (const QString &line : lines) {
+        const QChar *chars = line.constData();
+        const int len      = line.size();
+        const int oldSize  = m_buffer.size();
+
+        // Almost all generated code is plain ASCII; copy it without going through the codec.
+        m_buffer.resize(oldSize + len);
+        char *out = m_buffer.data() + oldSize;
+
+        int i = 0;
+        for (; i < len && chars[i].unicode() < 0x80; ++i) {
+            out[i] = static_cast<char>(chars[i].unicode());
+        }
+
+        if (i < len) {
+            m_buffer.resize(oldSize + i);
+            m_buffer.append(line.midRef(i).toUtf8());
+        }
+
+        m_buffer.append('\n');
+    }
+
+    return m_outFile.write(m_buffer) == m_buffer.size() && m_outFile.flush();
+}
+
+
 CodeWriter::CodeWriter()
 {
 }
@@ -57,6 +88,5 @@ bool CodeWriter::writeCode(const Module *module, const QStringList &lines)
     }
 
     assert(it != m_dests.end());
-    it->second << lines.join('\n') << '\n';
-    return true;
+    return it->second.writeLines(lines);
 }
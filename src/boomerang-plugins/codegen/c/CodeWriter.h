@@ -10,8 +10,7 @@
 #pragma once
 
 
-#include "boomerang/util/OStream.h"
-
+#include <QByteArray>
 #include <QFile>
 #include <QStringList>
 
@@ -37,17 +36,12 @@ class CodeWriter
         WriteDest &operator=(WriteDest &&) = delete;
 
     public:
-        template<typename T>
-        OStream &operator<<(T val)
-        {
-            m_os << val;
-            m_os.flush();
-            return m_os;
-        }
+        /// Writes \p lines as UTF-8 to the output file, one line per entry.
+        bool writeLines(const QStringList &lines);
 
     private:
         QFile m_outFile;
-        OStream m_os;
+        QByteArray m_buffer; ///< UTF-8 output, reused for every call to \ref writeLines
     };
 
     typedef std::map<const Module *, WriteDest> WriteDestMap;
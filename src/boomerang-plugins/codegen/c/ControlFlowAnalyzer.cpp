@@ -13,6 +13,8 @@
 #include "boomerang/db/proc/ProcCFG.h"
 #include "boomerang/util/log/Log.h"
 
+#include <algorithm>
+
 
 // index of the "then" branch of conditional jumps
 #define BTHEN 0
@@ -30,6 +32,11 @@ void ControlFlowAnalyzer::structureCFG(ProcCFG *cfg)
 {
     m_cfg = cfg;
 
+    // Only keep structuring information for the current proc. Otherwise the map (and every pass
+    // over it, like unTraverse) keeps growing with each proc that is generated.
+    m_info.clear();
+    m_info.reserve(cfg->getNumFragments());
+
     if (m_cfg->findRetFragment() == nullptr) {
         return;
     }
@@ -181,7 +188,8 @@ void ControlFlowAnalyzer::structConds()
 }
 
 
-void ControlFlowAnalyzer::determineLoopType(const IRFragment *header, bool *&loopNodes)
+void ControlFlowAnalyzer::determineLoopType(const IRFragment *header,
+                                            const std::vector<bool> &loopNodes)
 {
     assert(getLatchNode(header));
 
@@ -217,7 +225,8 @@ void ControlFlowAnalyzer::determineLoopType(const IRFragment *header, bool *&loo
 }
 
 
-void ControlFlowAnalyzer::findLoopFollow(const IRFragment *header, bool *&loopNodes)
+void ControlFlowAnalyzer::findLoopFollow(const IRFragment *header,
+                                         const std::vector<bool> &loopNodes)
 {
     assert(getStructType(header) == StructType::Loop ||
            getStructType(header) == StructType::LoopCond);
@@ -306,7 +315,7 @@ void ControlFlowAnalyzer::findLoopFollow(const IRFragment *header, bool *&loopNo
 }
 
 
-void ControlFlowAnalyzer::tagNodesInLoop(const IRFragment *header, bool *&loopNodes)
+void ControlFlowAnalyzer::tagNodesInLoop(const IRFragment *header, std::vector<bool> &loopNodes)
 {
     // Traverse the ordering structure from the header to the latch node tagging the nodes
     // determined to be within the loop. These are nodes that satisfy the following:
@@ -334,6 +343,10 @@ void ControlFlowAnalyzer::tagNodesInLoop(const IRFragment *header, bool *&loopNo
 
 void ControlFlowAnalyzer::structLoops()
 {
+    // maps each node to whether or not it is within the current loop.
+    // Shared by all loops; only the part spanned by a loop is reset after it has been structured.
+    std::vector<bool> loopNodes(m_postOrdering.size(), false);
+
     for (int i = m_postOrdering.size() - 1; i >= 0; i--) {
         const IRFragment *currFrag = m_postOrdering[i]; // the current node under investigation
         const IRFragment *latch    = nullptr;           // the latching node of the loop
@@ -364,13 +377,6 @@ void ControlFlowAnalyzer::structLoops()
             continue;
         }
 
-        // define the map that maps each node to whether or not it is within the current loop
-        bool *loopNodes = new bool[m_postOrdering.size()];
-
-        for (unsigned int j = 0; j < m_postOrdering.size(); j++) {
-            loopNodes[j] = false;
-        }
-
         setLatchNode(currFrag, latch);
 
         // the latching node may already have been structured as a conditional header. If it is
@@ -392,7 +398,9 @@ void ControlFlowAnalyzer::structLoops()
         // calculate the follow node of this loop
         findLoopFollow(currFrag, loopNodes);
 
-        delete[] loopNodes;
+        // tagNodesInLoop only tags nodes between the header and the latch node
+        std::fill(loopNodes.begin() + std::min(getPostOrdering(latch), i), loopNodes.begin() + i + 1,
+                  false);
     }
 }
 
@@ -515,10 +523,13 @@ bool ControlFlowAnalyzer::isCaseOption(const IRFragment *frag) const
 
 bool ControlFlowAnalyzer::isAncestorOf(const IRFragment *frag, const IRFragment *other) const
 {
-    return (m_info[frag].m_preOrderID < m_info[other].m_preOrderID &&
-            m_info[frag].m_postOrderID > m_info[other].m_postOrderID) ||
-           (m_info[frag].m_revPreOrderID < m_info[other].m_revPreOrderID &&
-            m_info[frag].m_revPostOrderID > m_info[other].m_revPostOrderID);
+    const FragStructInfo &fragInfo  = m_info[frag];
+    const FragStructInfo &otherInfo = m_info[other];
+
+    return (fragInfo.m_preOrderID < otherInfo.m_preOrderID &&
+            fragInfo.m_postOrderID > otherInfo.m_postOrderID) ||
+           (fragInfo.m_revPreOrderID < otherInfo.m_revPreOrderID &&
+            fragInfo.m_revPostOrderID > otherInfo.m_revPostOrderID);
 }
 
 
@@ -703,25 +714,29 @@ CondType ControlFlowAnalyzer::getCondType(const IRFragment *frag) const
 bool ControlFlowAnalyzer::isFragInLoop(const IRFragment *frag, const IRFragment *header,
                                        const IRFragment *latch) const
 {
-    assert(getLatchNode(header) == latch);
-    assert(header == latch || ((m_info[header].m_preOrderID > m_info[latch].m_preOrderID &&
-                                m_info[latch].m_postOrderID > m_info[header].m_postOrderID) ||
-                               (m_info[header].m_preOrderID < m_info[latch].m_preOrderID &&
-                                m_info[latch].m_postOrderID < m_info[header].m_postOrderID)));
+    const FragStructInfo &fragInfo   = m_info[frag];
+    const FragStructInfo &headerInfo = m_info[header];
+    const FragStructInfo &latchInfo  = m_info[latch];
+
+    assert(headerInfo.m_latchNode == latch);
+    assert(header == latch || ((headerInfo.m_preOrderID > latchInfo.m_preOrderID &&
+                                latchInfo.m_postOrderID > headerInfo.m_postOrderID) ||
+                               (headerInfo.m_preOrderID < latchInfo.m_preOrderID &&
+                                latchInfo.m_postOrderID < headerInfo.m_postOrderID)));
 
     // this node is in the loop if it is the latch node OR
     // this node is within the header and the latch is within this when using the forward loop
     // stamps OR this node is within the header and the latch is within this when using the reverse
     // loop stamps
     return frag == latch ||
-           (m_info[header].m_preOrderID < m_info[frag].m_preOrderID &&
-            m_info[frag].m_postOrderID < m_info[header].m_postOrderID &&
-            m_info[frag].m_preOrderID < m_info[latch].m_preOrderID &&
-            m_info[latch].m_postOrderID < m_info[frag].m_postOrderID) ||
-           (m_info[header].m_revPreOrderID < m_info[frag].m_revPreOrderID &&
-            m_info[frag].m_revPostOrderID < m_info[header].m_revPostOrderID &&
-            m_info[frag].m_revPreOrderID < m_info[latch].m_revPreOrderID &&
-            m_info[latch].m_revPostOrderID < m_info[frag].m_revPostOrderID);
+           (headerInfo.m_preOrderID < fragInfo.m_preOrderID &&
+            fragInfo.m_postOrderID < headerInfo.m_postOrderID &&
+            fragInfo.m_preOrderID < latchInfo.m_preOrderID &&
+            latchInfo.m_postOrderID < fragInfo.m_postOrderID) ||
+           (headerInfo.m_revPreOrderID < fragInfo.m_revPreOrderID &&
+            fragInfo.m_revPostOrderID < headerInfo.m_revPostOrderID &&
+            fragInfo.m_revPreOrderID < latchInfo.m_revPreOrderID &&
+            latchInfo.m_revPostOrderID < fragInfo.m_revPostOrderID);
 }
 
 
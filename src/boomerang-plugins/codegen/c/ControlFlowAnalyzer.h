@@ -273,16 +273,16 @@ private:
 
     /// \pre  The loop induced by (head,latch) has already had all its member nodes tagged
     /// \post The type of loop has been deduced
-    void determineLoopType(const IRFragment *header, bool *&loopNodes);
+    void determineLoopType(const IRFragment *header, const std::vector<bool> &loopNodes);
 
     /// \pre  The loop headed by header has been induced and all it's member nodes have been tagged
     /// \post The follow of the loop has been determined.
-    void findLoopFollow(const IRFragment *header, bool *&loopNodes);
+    void findLoopFollow(const IRFragment *header, const std::vector<bool> &loopNodes);
 
     /// \pre header has been detected as a loop header and has the details of the
     ///        latching node
     /// \post the nodes within the loop have been tagged
-    void tagNodesInLoop(const IRFragment *header, bool *&loopNodes);
+    void tagNodesInLoop(const IRFragment *header, std::vector<bool> &loopNodes);
 
     IRFragment *findEntryFragment() const;
     IRFragment *findExitFragment() const;
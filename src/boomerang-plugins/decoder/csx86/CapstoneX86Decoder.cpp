@@ -180,6 +180,44 @@ bool CapstoneX86Decoder::disassembleInstruction(Address pc, ptrdiff_t delta,
         return false;
     }
 
+    translateInstruction(result);
+    return true;
+}
+
+
+bool CapstoneX86Decoder::disassembleBlock(Address pc, Address limit, ptrdiff_t delta,
+                                          std::vector<MachineInstruction> &result)
+{
+    if (limit <= pc) {
+        return true;
+    }
+
+    // cs_disasm_iter advances the data pointer, the remaining size and the address
+    // after each instruction, so the whole block can be decoded in one sweep.
+    // The last instruction may extend beyond the limit.
+    const Byte *instructionData = reinterpret_cast<const Byte *>((HostAddress(delta) + pc).value());
+    size_t size                 = (limit - pc).value() + X86_MAX_INSTRUCTION_LENGTH - 1;
+    uint64 addr                 = pc.value();
+
+    while (addr < limit.value()) {
+        if (!cs_disasm_iter(m_handle, &instructionData, &size, &addr, m_insn)) {
+            return false;
+        }
+
+        MachineInstruction &insn = result.emplace_back();
+        translateInstruction(insn);
+
+        if (insn.isCTI()) {
+            break;
+        }
+    }
+
+    return true;
+}
+
+
+void CapstoneX86Decoder::translateInstruction(MachineInstruction &result)
+{
     result.m_addr = Address(m_insn->address);
     result.m_id   = m_insn->id;
     result.m_size = m_insn->size;
@@ -208,8 +246,6 @@ bool CapstoneX86Decoder::disassembleInstruction(Address pc, ptrdiff_t delta,
         assert(result.getNumOperands() > 0);
         result.setGroup(MIGroup::Computed, !result.m_operands[0]->isConst());
     }
-
-    return true;
 }
 
 
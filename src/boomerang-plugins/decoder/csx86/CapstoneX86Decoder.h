@@ -30,6 +30,10 @@ public:
     /// \copydoc IDecoder::decodeInstruction
     bool disassembleInstruction(Address pc, ptrdiff_t delta, MachineInstruction &result) override;
 
+    /// \copydoc IDecoder::disassembleBlock
+    bool disassembleBlock(Address pc, Address limit, ptrdiff_t delta,
+                          std::vector<MachineInstruction> &result) override;
+
     /// \copydoc IDecoder::liftInstruction
     bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted) override;
 
@@ -42,6 +46,9 @@ public:
 private:
     bool initialize(Project *project) override;
 
+    /// Converts the instruction last decoded into m_insn to a MachineInstruction.
+    void translateInstruction(MachineInstruction &result);
+
     /**
      * Creates a new RTL for a single instruction.
      * \param pc the address of the instruction to instantiate.
@@ -21,47 +21,244 @@
 #include <cstring>
 
 
-#define ST20_FUNC_J 0
-#define ST20_FUNC_LDLP 1
-#define ST20_FUNC_PFIX 2
-#define ST20_FUNC_LDNL 3
-#define ST20_FUNC_LDC 4
-#define ST20_FUNC_LDNLP 5
-#define ST20_FUNC_NFIX 6
-#define ST20_FUNC_LDL 7
-#define ST20_FUNC_ADC 8
-#define ST20_FUNC_CALL 9
-#define ST20_FUNC_CJ 10
-#define ST20_FUNC_AJW 11
-#define ST20_FUNC_EQC 12
-#define ST20_FUNC_STL 13
-#define ST20_FUNC_STNL 14
-#define ST20_FUNC_OPR 15
-
 #define OPR_MASK (1 << 16)
 #define OPR_SIGN (1 << 17)
 
 
-static const char *functionNames[] = {
-    "j",     //  0
-    "ldlp",  //  1
-    "pfix",  //  2
-    "ldnl",  //  3
-    "ldc",   //  4
-    "ldnlp", //  5
-    "nfix",  //  6
-    "ldl",   //  7
-    "adc",   //  8
-    "call",  //  9
-    "cj",    // 10
-    "ajw",   // 11
-    "eqc",   // 12
-    "stl",   // 13
-    "stnl",  // 14
-    "opr"    // 15
+/// How the operand of a function code is decoded
+enum class ST20OperandKind : uint8
+{
+    Imm,       ///< the prefix total is an immediate value
+    RelAddr,   ///< the prefix total is a jump/call offset relative to the next instruction
+    Opr,       ///< the prefix total selects an operation (see \ref oprSpec)
+    Prefix,    ///< the operand is added to the prefix total
+    NegPrefix, ///< the complement of the operand is added to the prefix total
 };
 
 
+struct ST20FunctionSpec
+{
+    const char *name;
+    ST20OperandKind operandKind;
+};
+
+
+struct ST20OprSpec
+{
+    int prefixTotal;
+    const char *name;
+};
+
+
+static const ST20FunctionSpec functionSpec[] = {
+    { "j", ST20OperandKind::RelAddr },      //  0
+    { "ldlp", ST20OperandKind::Imm },       //  1
+    { "pfix", ST20OperandKind::Prefix },    //  2
+    { "ldnl", ST20OperandKind::Imm },       //  3
+    { "ldc", ST20OperandKind::Imm },        //  4
+    { "ldnlp", ST20OperandKind::Imm },      //  5
+    { "nfix", ST20OperandKind::NegPrefix }, //  6
+    { "ldl", ST20OperandKind::Imm },        //  7
+    { "adc", ST20OperandKind::Imm },        //  8
+    { "call", ST20OperandKind::RelAddr },   //  9
+    { "cj", ST20OperandKind::RelAddr },     // 10
+    { "ajw", ST20OperandKind::Imm },        // 11
+    { "eqc", ST20OperandKind::Imm },        // 12
+    { "stl", ST20OperandKind::Imm },        // 13
+    { "stnl", ST20OperandKind::Imm },       // 14
+    { "opr", ST20OperandKind::Opr }         // 15
+};
+
+
+/// Operations selected by a non-negative prefix total
+static const ST20OprSpec oprSpec[] = {
+    { 0x00, "rev" },
+    { 0x01, "lb" },
+    { 0x02, "bsub" },
+    { 0x03, "endp" },
+    { 0x04, "diff" },
+    { 0x05, "add" },
+    { 0x06, "gcall" },
+    { 0x07, "in" },
+    { 0x08, "prod" },
+    { 0x09, "gt" },
+    { 0x0A, "wsub" },
+    { 0x0B, "out" },
+    { 0x0C, "sub" },
+    { 0x0D, "startp" },
+    { 0x0E, "outbyte" },
+    { 0x0F, "outword" },
+    { 0x10, "seterr" },
+    { 0x12, "resetch" },
+    { 0x13, "csub0" },
+    { 0x15, "stopp" },
+    { 0x16, "ladd" },
+    { 0x17, "stlb" },
+    { 0x18, "sthf" },
+    { 0x19, "norm" },
+    { 0x1A, "ldiv" },
+    { 0x1B, "ldpi" },
+    { 0x1C, "stlf" },
+    { 0x1D, "xdble" },
+    { 0x1E, "ldpri" },
+    { 0x1F, "rem" },
+    { 0x20, "ret" },
+    { 0x21, "lend" },
+    { 0x22, "ldtimer" },
+    { 0x29, "testerr" },
+    { 0x2A, "testpranal" },
+    { 0x2B, "tin" },
+    { 0x2C, "div" },
+    { 0x2E, "dist" },
+    { 0x2F, "disc" },
+    { 0x30, "diss" },
+    { 0x31, "lmul" },
+    { 0x32, "not" },
+    { 0x33, "xor" },
+    { 0x34, "bcnt" },
+    { 0x35, "lshr" },
+    { 0x36, "lshl" },
+    { 0x37, "lsum" },
+    { 0x38, "lsub" },
+    { 0x39, "runp" },
+    { 0x3A, "xword" },
+    { 0x3B, "sb" },
+    { 0x3C, "gajw" },
+    { 0x3D, "savel" },
+    { 0x3E, "saveh" },
+    { 0x3F, "wcnt" },
+    { 0x40, "shr" },
+    { 0x41, "shl" },
+    { 0x42, "mint" },
+    { 0x43, "alt" },
+    { 0x44, "altwt" },
+    { 0x45, "altend" },
+    { 0x46, "and" },
+    { 0x47, "enbt" },
+    { 0x48, "enbc" },
+    { 0x49, "enbs" },
+    { 0x4A, "move" },
+    { 0x4B, "or" },
+    { 0x4C, "csngl" },
+    { 0x4D, "ccnt1" },
+    { 0x4E, "talt" },
+    { 0x4F, "ldiff" },
+    { 0x50, "sthb" },
+    { 0x51, "taltwt" },
+    { 0x52, "sum" },
+    { 0x53, "mul" },
+    { 0x54, "sttimer" },
+    { 0x55, "stoperr" },
+    { 0x56, "cword" },
+    { 0x57, "clrhalterr" },
+    { 0x58, "sethalterr" },
+    { 0x59, "testhalterr" },
+    { 0x5A, "dup" },
+    { 0x5B, "move2dinit" },
+    { 0x5C, "move2dall" },
+    { 0x5D, "move2dnonzero" },
+    { 0x5E, "move2dzero" },
+    { 0x5F, "gtu" },
+    { 0x63, "unpacksn" },
+    { 0x64, "slmul" },
+    { 0x65, "sulmul" },
+    { 0x68, "satadd" },
+    { 0x69, "satsub" },
+    { 0x6A, "satmul" },
+    { 0x6C, "postnormsn" },
+    { 0x6D, "roundsn" },
+    { 0x6E, "ldtraph" },
+    { 0x6F, "sttraph" },
+    { 0x71, "ldinf" },
+    { 0x72, "fmul" },
+    { 0x73, "cflerr" },
+    { 0x74, "crcword" },
+    { 0x75, "crcbyte" },
+    { 0x76, "bitcnt" },
+    { 0x77, "bitrevword" },
+    { 0x78, "bitrevnbits" },
+    { 0x79, "pop" },
+    { 0x7E, "ldmemstartval" },
+    { 0x81, "wsubdb" },
+    { 0x9C, "fptesterr" },
+    { 0xB0, "settimeslice" },
+    { 0xB8, "xbword" },
+    { 0xB9, "lbx" },
+    { 0xBA, "cb" },
+    { 0xBB, "cbu" },
+    { 0xC1, "ssub" },
+    { 0xC4, "intdis" },
+    { 0xC5, "intenb" },
+    { 0xC6, "ldtrapped" },
+    { 0xC7, "cir" },
+    { 0xC8, "ss" },
+    { 0xCA, "ls" },
+    { 0xCB, "sttrapped" },
+    { 0xCC, "ciru" },
+    { 0xCD, "gintdis" },
+    { 0xCE, "gintenb" },
+    { 0xF0, "devlb" },
+    { 0xF1, "devsb" },
+    { 0xF2, "devls" },
+    { 0xF3, "devss" },
+    { 0xF4, "devlw" },
+    { 0xF5, "devsw" },
+    { 0xF6, "null" },
+    { 0xF7, "null" },
+    { 0xF8, "xsword" },
+    { 0xF9, "lsx" },
+    { 0xFA, "cs" },
+    { 0xFB, "csu" },
+    { 0x17C, "lddevid" },
+};
+
+
+/// Operations selected by a negative prefix total (as a result of nfixes).
+/// The prefix total is stored in the form (~total & ~0xF) | (total & 0xF).
+static const ST20OprSpec negOprSpec[] = {
+    { 0x00, "swapqueue" },
+    { 0x01, "swaptimer" },
+    { 0x02, "insertqueue" },
+    { 0x03, "timeslice" },
+    { 0x04, "signal" },
+    { 0x05, "wait" },
+    { 0x06, "trapdis" },
+    { 0x07, "trapenb" },
+    { 0x0B, "tret" },
+    { 0x0C, "ldshadow" },
+    { 0x0D, "stshadow" },
+    { 0x1F, "iret" },
+    { 0x24, "devmove" },
+    { 0x2E, "restart" },
+    { 0x2F, "causeerror" },
+    { 0x30, "nop" },
+    { 0x4C, "stclock" },
+    { 0x4D, "ldclock" },
+    { 0x4E, "clockdis" },
+    { 0x4F, "clockenb" },
+    { 0x8C, "ldprodid" },
+    { 0x8D, "reboot" },
+};
+
+
+/// Build a table mapping the prefix total of each operation in \p spec to its opcode info.
+template<std::size_t N>
+static std::vector<ST20Decoder::OpcodeInfo> buildOprTable(const ST20OprSpec (&spec)[N])
+{
+    std::vector<ST20Decoder::OpcodeInfo> table;
+
+    for (const ST20OprSpec &opr : spec) {
+        if (table.size() <= static_cast<std::size_t>(opr.prefixTotal)) {
+            table.resize(opr.prefixTotal + 1);
+        }
+
+        table[opr.prefixTotal] = { opr.name, QString(opr.name).toUpper() };
+    }
+
+    return table;
+}
+
+
 ST20Decoder::ST20Decoder(Project *project)
     : IDecoder(project)
     , m_rtlDict(project->getSettings()->debugDecoder)
@@ -80,6 +277,13 @@ ST20Decoder::ST20Decoder(Project *project)
         LOG_ERROR("Cannot read SSL file '%1'", realSSLFileName);
         throw std::runtime_error("Cannot read SSL file");
     }
+
+    for (std::size_t i = 0; i < m_functions.size(); ++i) {
+        m_functions[i] = { functionSpec[i].name, QString(functionSpec[i].name).toUpper() };
+    }
+
+    m_oprs    = buildOprTable(oprSpec);
+    m_negOprs = buildOprTable(negOprSpec);
 }
 
 
@@ -92,9 +296,9 @@ bool ST20Decoder::initialize(Project *project)
 
 bool ST20Decoder::disassembleInstruction(Address pc, ptrdiff_t delta, MachineInstruction &result)
 {
-    bool valid    = false; //< Is this a valid instruction?
-    int total     = 0;     // Total value from all prefixes
+    int total     = 0; // Total value from all prefixes
     result.m_size = 0;
+    result.m_operands.clear();
 
     while (true) {
         const Byte instructionData = Util::readByte(
@@ -104,94 +308,46 @@ bool ST20Decoder::disassembleInstruction(Address pc, ptrdiff_t delta, MachineIns
 
         result.m_size++;
 
-        switch (functionCode) {
-        case ST20_FUNC_J: { // unconditional jump
-            total += oper;
-            const Address jumpDest = pc + result.m_size + total;
-
-            result.m_addr = pc;
-            result.m_id   = ST20_FUNC_J;
+        switch (functionSpec[functionCode].operandKind) {
+        case ST20OperandKind::Prefix: total = (total + oper) << 4; continue;
+        case ST20OperandKind::NegPrefix: total = (total + ~oper) << 4; continue;
 
-            std::strcpy(result.m_mnem.data(), "j");
-            std::snprintf(result.m_opstr.data(), result.m_opstr.size(), "%s",
-                          qPrintable(jumpDest.toString()));
-            result.m_operands.push_back(Const::get(jumpDest));
-            result.m_templateName = "J";
-
-            valid = true;
-        } break;
-
-        case ST20_FUNC_LDLP:
-        case ST20_FUNC_LDNL:
-        case ST20_FUNC_LDC:
-        case ST20_FUNC_LDNLP:
-        case ST20_FUNC_LDL:
-        case ST20_FUNC_ADC:
-        case ST20_FUNC_AJW:
-        case ST20_FUNC_EQC:
-        case ST20_FUNC_STL:
-        case ST20_FUNC_STNL: {
+        case ST20OperandKind::RelAddr: { // jump, cond jump or call
             total += oper;
+            const Address dest     = pc + result.m_size + total;
+            const OpcodeInfo &info = m_functions[functionCode];
 
             result.m_addr = pc;
             result.m_id   = functionCode;
 
-            std::strcpy(result.m_mnem.data(), functionNames[functionCode]);
-            std::snprintf(result.m_opstr.data(), result.m_opstr.size(), "0x%x", total);
-
-            result.m_operands.push_back(Const::get(total));
-            result.m_templateName = QString(functionNames[functionCode]).toUpper();
-
-            valid = true;
-        } break;
-
-        case ST20_FUNC_PFIX: { // prefix
-            total = (total + oper) << 4;
-            continue;
-        }
-        case ST20_FUNC_NFIX: { // negative prefix
-            total = (total + ~oper) << 4;
-            continue;
-        }
-
-        case ST20_FUNC_CALL: { // call
-            total += oper;
-            const Address callDest = Address(pc + result.m_size + total);
-
-            result.m_addr = pc;
-            result.m_id   = ST20_FUNC_CALL;
-
-            std::strcpy(result.m_mnem.data(), "call");
+            std::strcpy(result.m_mnem.data(), info.name);
             std::snprintf(result.m_opstr.data(), result.m_opstr.size(), "%s",
-                          qPrintable(callDest.toString()));
-
-            result.m_operands.push_back(Const::get(callDest));
-            result.m_templateName = "CALL";
+                          qPrintable(dest.toString()));
 
-            valid = true;
-        } break;
+            result.m_operands.push_back(Const::get(dest));
+            result.m_templateName = info.templateName;
+            return true;
+        }
 
-        case ST20_FUNC_CJ: { // cond jump
+        case ST20OperandKind::Imm: {
             total += oper;
-            const Address jumpDest = pc + result.m_size + total;
+            const OpcodeInfo &info = m_functions[functionCode];
 
             result.m_addr = pc;
-            result.m_id   = ST20_FUNC_CJ;
-
-            std::strcpy(result.m_mnem.data(), "cj");
-            std::snprintf(result.m_opstr.data(), result.m_opstr.size(), "%s",
-                          qPrintable(jumpDest.toString()));
+            result.m_id   = functionCode;
 
-            result.m_operands.push_back(Const::get(jumpDest));
-            result.m_templateName = "CJ";
+            std::strcpy(result.m_mnem.data(), info.name);
+            std::snprintf(result.m_opstr.data(), result.m_opstr.size(), "0x%x", total);
 
-            valid = true;
-        } break;
+            result.m_operands.push_back(Const::get(total));
+            result.m_templateName = info.templateName;
+            return true;
+        }
 
-        case ST20_FUNC_OPR: { // operate
+        case ST20OperandKind::Opr: { // operate
             total += oper;
-            const char *insnName = getInstructionName(total);
-            if (!insnName) {
+            const OpcodeInfo *info = getOprInfo(total);
+            if (!info) {
                 // invalid or unknown instruction
                 return false;
             }
@@ -200,20 +356,15 @@ bool ST20Decoder::disassembleInstruction(Address pc, ptrdiff_t delta, MachineIns
             result.m_id   = OPR_MASK |
                           (total > 0 ? total : ((~total & ~0xF) | (total & 0xF) | OPR_SIGN));
 
-            std::strcpy(result.m_mnem.data(), insnName);
+            std::strcpy(result.m_mnem.data(), info->name);
             std::strcpy(result.m_opstr.data(), "");
-            result.m_templateName = QString(insnName).toUpper();
-
-            valid = true;
-        } break;
-
-        default: return false;
+            result.m_templateName = info->templateName;
+            return true;
+        }
         }
 
-        break;
+        return false;
     }
-
-    return valid;
 }
 
 
@@ -225,189 +376,27 @@ bool ST20Decoder::liftInstruction(const MachineInstruction &insn, LiftedInstruct
 }
 
 
-const char *ST20Decoder::getInstructionName(int prefixTotal) const
+const ST20Decoder::OpcodeInfo *ST20Decoder::getOprInfo(int prefixTotal) const
 {
-    if (prefixTotal >= 0) {
-        switch (prefixTotal) {
-        case 0x00: return "rev";
-        case 0x01: return "lb";
-        case 0x02: return "bsub";
-        case 0x03: return "endp";
-        case 0x04: return "diff";
-        case 0x05: return "add";
-        case 0x06: return "gcall";
-        case 0x07: return "in";
-        case 0x08: return "prod";
-        case 0x09: return "gt";
-        case 0x0A: return "wsub";
-        case 0x0B: return "out";
-        case 0x0C: return "sub";
-        case 0x0D: return "startp";
-        case 0x0E: return "outbyte";
-        case 0x0F: return "outword";
-        case 0x10: return "seterr";
-        case 0x12: return "resetch";
-        case 0x13: return "csub0";
-        case 0x15: return "stopp";
-        case 0x16: return "ladd";
-        case 0x17: return "stlb";
-        case 0x18: return "sthf";
-        case 0x19: return "norm";
-        case 0x1A: return "ldiv";
-        case 0x1B: return "ldpi";
-        case 0x1C: return "stlf";
-        case 0x1D: return "xdble";
-        case 0x1E: return "ldpri";
-        case 0x1F: return "rem";
-        case 0x20: return "ret";
-        case 0x21: return "lend";
-        case 0x22: return "ldtimer";
-        case 0x29: return "testerr";
-        case 0x2A: return "testpranal";
-        case 0x2B: return "tin";
-        case 0x2C: return "div";
-        case 0x2E: return "dist";
-        case 0x2F: return "disc";
-        case 0x30: return "diss";
-        case 0x31: return "lmul";
-        case 0x32: return "not";
-        case 0x33: return "xor";
-        case 0x34: return "bcnt";
-        case 0x35: return "lshr";
-        case 0x36: return "lshl";
-        case 0x37: return "lsum";
-        case 0x38: return "lsub";
-        case 0x39: return "runp";
-        case 0x3A: return "xword";
-        case 0x3B: return "sb";
-        case 0x3C: return "gajw";
-        case 0x3D: return "savel";
-        case 0x3E: return "saveh";
-        case 0x3F: return "wcnt";
-        case 0x40: return "shr";
-        case 0x41: return "shl";
-        case 0x42: return "mint";
-        case 0x43: return "alt";
-        case 0x44: return "altwt";
-        case 0x45: return "altend";
-        case 0x46: return "and";
-        case 0x47: return "enbt";
-        case 0x48: return "enbc";
-        case 0x49: return "enbs";
-        case 0x4A: return "move";
-        case 0x4B: return "or";
-        case 0x4C: return "csngl";
-        case 0x4D: return "ccnt1";
-        case 0x4E: return "talt";
-        case 0x4F: return "ldiff";
-        case 0x50: return "sthb";
-        case 0x51: return "taltwt";
-        case 0x52: return "sum";
-        case 0x53: return "mul";
-        case 0x54: return "sttimer";
-        case 0x55: return "stoperr";
-        case 0x56: return "cword";
-        case 0x57: return "clrhalterr";
-        case 0x58: return "sethalterr";
-        case 0x59: return "testhalterr";
-        case 0x5A: return "dup";
-        case 0x5B: return "move2dinit";
-        case 0x5C: return "move2dall";
-        case 0x5D: return "move2dnonzero";
-        case 0x5E: return "move2dzero";
-        case 0x5F: return "gtu";
-        case 0x63: return "unpacksn";
-        case 0x64: return "slmul";
-        case 0x65: return "sulmul";
-        case 0x68: return "satadd";
-        case 0x69: return "satsub";
-        case 0x6A: return "satmul";
-        case 0x6C: return "postnormsn";
-        case 0x6D: return "roundsn";
-        case 0x6E: return "ldtraph";
-        case 0x6F: return "sttraph";
-        case 0x71: return "ldinf";
-        case 0x72: return "fmul";
-        case 0x73: return "cflerr";
-        case 0x74: return "crcword";
-        case 0x75: return "crcbyte";
-        case 0x76: return "bitcnt";
-        case 0x77: return "bitrevword";
-        case 0x78: return "bitrevnbits";
-        case 0x79: return "pop";
-        case 0x7E: return "ldmemstartval";
-        case 0x81: return "wsubdb";
-        case 0x9C: return "fptesterr";
-        case 0xB0: return "settimeslice";
-        case 0xB8: return "xbword";
-        case 0xB9: return "lbx";
-        case 0xBA: return "cb";
-        case 0xBB: return "cbu";
-        case 0xC1: return "ssub";
-        case 0xC4: return "intdis";
-        case 0xC5: return "intenb";
-        case 0xC6: return "ldtrapped";
-        case 0xC7: return "cir";
-        case 0xC8: return "ss";
-        case 0xCA: return "ls";
-        case 0xCB: return "sttrapped";
-        case 0xCC: return "ciru";
-        case 0xCD: return "gintdis";
-        case 0xCE: return "gintenb";
-        case 0xF0: return "devlb";
-        case 0xF1: return "devsb";
-        case 0xF2: return "devls";
-        case 0xF3: return "devss";
-        case 0xF4: return "devlw";
-        case 0xF5: return "devsw";
-        case 0xF6: return "null";
-        case 0xF7: return "null";
-        case 0xF8: return "xsword";
-        case 0xF9: return "lsx";
-        case 0xFA: return "cs";
-        case 0xFB: return "csu";
-        case 0x17C: return "lddevid";
-        }
-    }
-    else {
+    const std::vector<OpcodeInfo> *table = &m_oprs;
+
+    if (prefixTotal < 0) {
         // Total is negative, as a result of nfixes
         prefixTotal = (~prefixTotal & ~0xF) | (prefixTotal & 0xF);
+        table       = &m_negOprs;
+    }
 
-        switch (prefixTotal) {
-        case 0x00: return "swapqueue";
-        case 0x01: return "swaptimer";
-        case 0x02: return "insertqueue";
-        case 0x03: return "timeslice";
-        case 0x04: return "signal";
-        case 0x05: return "wait";
-        case 0x06: return "trapdis";
-        case 0x07: return "trapenb";
-        case 0x0B: return "tret";
-        case 0x0C: return "ldshadow";
-        case 0x0D: return "stshadow";
-        case 0x1F: return "iret";
-        case 0x24: return "devmove";
-        case 0x2E: return "restart";
-        case 0x2F: return "causeerror";
-        case 0x30: return "nop";
-        case 0x4C: return "stclock";
-        case 0x4D: return "ldclock";
-        case 0x4E: return "clockdis";
-        case 0x4F: return "clockenb";
-        case 0x8C: return "ldprodid";
-        case 0x8D: return "reboot";
-        }
+    if (static_cast<std::size_t>(prefixTotal) >= table->size()) {
+        return nullptr;
     }
 
-    return nullptr;
+    const OpcodeInfo &info = (*table)[prefixTotal];
+    return info.name ? &info : nullptr;
 }
 
 
 std::unique_ptr<RTL> ST20Decoder::instantiateRTL(const MachineInstruction &insn)
 {
-    // Take the argument, convert it to upper case and remove any .'s
-    const QString sanitizedName = QString(insn.m_templateName).remove(".").toUpper();
-
     // Display a disassembly of this instruction if requested
     if (m_prog && m_prog->getProject()->getSettings()->debugDecoder) {
         QString msg{ insn.m_addr.toString() + " " + insn.m_templateName + " " };
@@ -433,7 +422,8 @@ std::unique_ptr<RTL> ST20Decoder::instantiateRTL(const MachineInstruction &insn)
         LOG_MSG("%1", msg);
     }
 
-    return m_rtlDict.instantiateRTL(sanitizedName, insn.m_addr, insn.m_operands);
+    // template names of the opcode tables are already in dictionary form (upper case, no '.')
+    return m_rtlDict.instantiateRTL(insn.m_templateName, insn.m_addr, insn.m_operands);
 }
 
 
@@ -15,12 +15,23 @@
 #include "boomerang/ssl/RTLInstDict.h"
 #include "boomerang/ssl/exp/ExpHelp.h"
 
+#include <array>
+#include <vector>
+
 
 /**
  * The definition of the instruction decoder for ST20.
  */
 class BOOMERANG_PLUGIN_API ST20Decoder : public IDecoder
 {
+public:
+    /// Decoding information of a single function code or operation
+    struct OpcodeInfo
+    {
+        const char *name = nullptr; ///< mnemonic; nullptr for invalid opcodes
+        QString templateName;       ///< name of the SSL template
+    };
+
 public:
     /// \copydoc IDecoder::IDecoder
     ST20Decoder(Project *project);
@@ -68,12 +79,18 @@ private:
     std::unique_ptr<RTL> instantiateRTL(const MachineInstruction &insn);
 
     /// \param prefixTotal The sum of all prefixes
-    /// \returns the name of an instruction determined by its prefixes (e.g. 0x53 -> mul)
-    const char *getInstructionName(int prefixTotal) const;
+    /// \returns the operation determined by its prefixes (e.g. 0x53 -> mul),
+    /// or nullptr if the operation is invalid.
+    const OpcodeInfo *getOprInfo(int prefixTotal) const;
 
 private:
     /// Dictionary of instruction patterns, and other information summarised from the SSL file
     /// (e.g. source machine's endianness)
     RTLInstDict m_rtlDict;
     Prog *m_prog = nullptr;
+
+    /// Opcode tables generated from the instruction specification at construction time
+    std::array<OpcodeInfo, 16> m_functions; ///< indexed by function code
+    std::vector<OpcodeInfo> m_oprs;         ///< operations indexed by non-negative prefix total
+    std::vector<OpcodeInfo> m_negOprs;      ///< operations indexed by negated prefix total
 };
@@ -30,6 +30,9 @@ PPCFrontEnd::PPCFrontEnd(Project *project)
     Plugin *plugin = project->getPluginManager()->getPluginByName("Capstone PPC decoder plugin");
     if (plugin) {
         m_decoder = plugin->getIfc<IDecoder>();
+    }
+
+    if (m_decoder) {
         m_decoder->initialize(project);
     }
 }
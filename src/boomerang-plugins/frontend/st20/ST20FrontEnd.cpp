@@ -26,6 +26,9 @@ ST20FrontEnd::ST20FrontEnd(Project *project)
     Plugin *plugin = project->getPluginManager()->getPluginByName("ST20 decoder plugin");
     if (plugin) {
         m_decoder = plugin->getIfc<IDecoder>();
+    }
+
+    if (m_decoder) {
         m_decoder->initialize(project);
     }
 }
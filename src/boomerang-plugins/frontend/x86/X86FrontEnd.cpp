@@ -49,41 +49,45 @@ bool X86FrontEnd::disassembleProc(UserProc *function, Address addr)
 }
 
 
-bool X86FrontEnd::liftProcImpl(UserProc *proc)
+void X86FrontEnd::processLiftedStatements(UserProc *proc)
 {
-    if (!DefaultFrontEnd::liftProcImpl(proc)) {
-        return false;
-    }
-
-    // Process away %rpt and %skip
+    // Process away %rpt and %skip. This splits fragments,
+    // so it has to be done before fragments are assigned to statements.
     processStringInst(proc);
 
+    std::set<RegNum> usedRegs;
+    std::vector<std::shared_ptr<Assignment>> asgns;
+
     IRFragment::RTLIterator rit;
     StatementList::iterator sit;
-    ProcCFG *procCFG = proc->getCFG();
 
-    for (IRFragment *frag : *procCFG) {
+    for (IRFragment *frag : *proc->getCFG()) {
+        const bool needsOverlapProcessing = !isOverlappedRegsProcessed(frag);
+
         for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt != nullptr;
              stmt            = frag->getNextStmt(rit, sit)) {
             assert(stmt->getProc() == nullptr || stmt->getProc() == proc);
             stmt->setProc(proc);
             stmt->setFragment(frag);
-        }
-    }
 
-    // Process code for side effects of overlapped registers
-    processOverlapped(proc);
+            // look for any uses of registers
+            LocationSet locs;
+            stmt->addUsedLocs(locs);
 
-    for (IRFragment *frag : *procCFG) {
-        for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt != nullptr;
-             stmt            = frag->getNextStmt(rit, sit)) {
-            assert(stmt->getProc() == nullptr || stmt->getProc() == proc);
-            stmt->setProc(proc);
-            stmt->setFragment(frag);
+            for (const SharedExp &l : locs) {
+                if (l->isRegOfConst()) {
+                    usedRegs.insert(l->access<Const, 1>()->getInt());
+                }
+            }
+
+            if (needsOverlapProcessing && stmt->isAssignment()) {
+                asgns.push_back(stmt->as<Assignment>());
+            }
         }
     }
 
-    return true;
+    // Process code for side effects of overlapped registers
+    processOverlapped(proc, usedRegs, asgns);
 }
 
 
@@ -318,51 +322,33 @@ void X86FrontEnd::processStringInst(UserProc *proc)
 }
 
 
-void X86FrontEnd::processOverlapped(UserProc *proc)
+void X86FrontEnd::processOverlapped(UserProc *proc, const std::set<RegNum> &usedRegs,
+                                    const std::vector<std::shared_ptr<Assignment>> &asgns)
 {
-    // first, lets look for any uses of the registers
-    std::set<RegNum> usedRegs;
-    StatementList stmts;
-    proc->getStatements(stmts);
-
-    for (SharedStmt s : stmts) {
-        LocationSet locs;
-        s->addUsedLocs(locs);
-
-        for (SharedExp l : locs) {
-            if (l->isRegOfConst()) {
-                usedRegs.insert(l->access<Const, 1>()->getInt());
-            }
-        }
-    }
-
-    std::set<IRFragment *> frags;
-
-    for (SharedStmt s : stmts) {
-        if (isOverlappedRegsProcessed(s->getFragment())) { // never redo processing
-            continue;
-        }
-
-        frags.insert(s->getFragment());
-
-        if (!s->isAssignment()) {
-            continue;
-        }
+    UserProc::StmtInsertionMap insertions;
 
+    for (const std::shared_ptr<Assignment> &asgn : asgns) {
         std::unique_ptr<RTL> overlapResult = m_decoder->getDict()
                                                  ->getRegDB()
-                                                 ->processOverlappedRegs(s->as<Assignment>(),
-                                                                         usedRegs);
+                                                 ->processOverlappedRegs(asgn, usedRegs);
 
-        if (overlapResult) {
-            for (SharedStmt res : *overlapResult) {
-                proc->insertStatementAfter(s, res->clone());
+        if (overlapResult && !overlapResult->empty()) {
+            // The statements are freshly created, so there is no need to clone them.
+            // The last overlap effect is placed directly after the original assignment.
+            for (const SharedStmt &res : *overlapResult) {
+                res->setProc(proc);
             }
+
+            insertions[asgn].assign(overlapResult->rbegin(), overlapResult->rend());
         }
     }
 
+    proc->insertStatementsAfter(insertions);
+
     // set a flag for every fragment we've processed so we don't do them again
-    m_overlappedRegsProcessed.insert(frags.begin(), frags.end());
+    for (IRFragment *frag : *proc->getCFG()) {
+        m_overlappedRegsProcessed.insert(frag);
+    }
 }
 
 
@@ -12,10 +12,14 @@
 
 #include "boomerang/core/BoomerangAPI.h"
 #include "boomerang/frontend/DefaultFrontEnd.h"
+#include "boomerang/ssl/Register.h"
 
+#include <set>
 #include <unordered_set>
+#include <vector>
 
 
+class Assignment;
 class IRFragment;
 
 
@@ -47,8 +51,8 @@ public:
     Address findMainEntryPoint(bool &gotMain) override;
 
 protected:
-    /// \copydoc DefaultFrontEnd::liftProcImpl
-    bool liftProcImpl(UserProc *proc) override;
+    /// \copydoc DefaultFrontEnd::processLiftedStatements
+    void processLiftedStatements(UserProc *proc) override;
 
     /// \copydoc IFrontEnd::extraProcessCall
     /// EXPERIMENTAL: can we find function pointers in arguments to calls this early?
@@ -62,8 +66,11 @@ private:
 
     /**
      * Process for overlapped registers
+     * \param usedRegs all registers used in \p proc
+     * \param asgns    all assignments of \p proc in fragments not processed before
      */
-    void processOverlapped(UserProc *proc);
+    void processOverlapped(UserProc *proc, const std::set<RegNum> &usedRegs,
+                           const std::vector<std::shared_ptr<Assignment>> &asgns);
 
     /**
      * Checks for x86 specific helper functions like __xtol which have specific sematics.
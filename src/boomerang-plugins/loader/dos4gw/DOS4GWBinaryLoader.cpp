@@ -48,8 +48,9 @@ DOS4GWBinaryLoader::~DOS4GWBinaryLoader()
 
 void DOS4GWBinaryLoader::initialize(BinaryFile *file, BinarySymbolTable *symbols)
 {
-    m_image   = file->getImage();
-    m_symbols = symbols;
+    m_binaryFile = file;
+    m_image      = file->getImage();
+    m_symbols    = symbols;
 
     file->setBitness(16);
 }
@@ -349,6 +350,7 @@ bool DOS4GWBinaryLoader::loadFromMemory(QByteArray &data)
         unsigned long target = READ4_LE(m_LXObjects[object - 1].RelocBaseAddr) + READ2_LE(trgoff);
         //        printf("relocate dword at %x to point to %x\n", src, target);
         Util::writeDWord(&m_imageBase[src], target, Endian::Little);
+        m_binaryFile->addRelocation(Address(READ4_LE(m_LXObjects[0].RelocBaseAddr) + src));
 
         while (buf.pos() - (READ4_LE(m_LXHeader.fixuprecordtbloffset) + lxoff) >=
                READ4_LE(fixuppagetbl[srcpage + 1])) {
@@ -163,4 +163,5 @@ private:
     /// Map from address of dynamic pointers to library procedure names:
     BinarySymbolTable *m_symbols = nullptr;
     BinaryImage *m_image         = nullptr;
+    BinaryFile *m_binaryFile     = nullptr;
 };
@@ -22,6 +22,8 @@
 #include <QBuffer>
 #include <QFile>
 
+#include <cstring>
+
 
 struct SectionParam
 {
@@ -53,6 +55,19 @@ struct Translated_ElfSym
 typedef std::map<QString, int, std::less<QString>> StrIntMap;
 
 
+/// Converts a symbol name from a string table to a QString, removing the symbol version
+/// (e.g. "@@GLIBC_2.0"), if present. The name is converted only once.
+static QString symbolNameFromStrTab(const char *rawName)
+{
+    if (rawName == nullptr) {
+        return QString();
+    }
+
+    const char *versionSep = std::strstr(rawName, "@@");
+    return QString::fromUtf8(rawName, versionSep ? static_cast<int>(versionSep - rawName) : -1);
+}
+
+
 ElfBinaryLoader::ElfBinaryLoader(Project *project)
     : IFileLoader(project)
     , m_nextExtern(Address::ZERO)
@@ -485,14 +500,13 @@ Address ElfBinaryLoader::findRelPltOffset(int i)
 }
 
 
-void ElfBinaryLoader::processSymbol(Translated_ElfSym &sym, int e_type, int i,
+void ElfBinaryLoader::processSymbol(Translated_ElfSym &sym, int e_type, int i, bool hasPLT,
                                     const QString &currentFile)
 {
-    bool imported              = sym.SectionIdx == SHT_NULL;
-    bool local                 = sym.Binding == STB_LOCAL || sym.Binding == STB_WEAK;
-    const BinarySection *siPlt = m_binaryFile->getImage()->getSectionByName(".plt");
+    bool imported = sym.SectionIdx == SHT_NULL;
+    bool local    = sym.Binding == STB_LOCAL || sym.Binding == STB_WEAK;
 
-    if (sym.Value.isZero() && siPlt) { // && i < max_i_for_hack) {
+    if (sym.Value.isZero() && hasPLT) { // && i < max_i_for_hack) {
         // Special hack for gcc circa 3.3.3: (e.g. test/x86/settest).  The value in the dynamic
         // symbol table is zero!  I was assuming that index i in the dynamic symbol table would
         // always correspond to index i in the .plt section, but for fedora2_true, this doesn't
@@ -581,38 +595,44 @@ void ElfBinaryLoader::addSymbolsForSection(int secIndex)
     }
 
     const int numSymbols = section.Size / section.entry_size;
+    const bool hasPLT    = m_binaryFile->getImage()->getSectionByName(".plt") != nullptr;
     QString fileName;
 
     // Index 0 is a dummy entry
     for (int i = 1; i < numSymbols; i++) {
-        Translated_ElfSym translatedSym;
-        Address val = Address(elfRead4(&m_symbolSection[i].st_value));
-        int nameIdx = elfRead4(&m_symbolSection[i].st_name);
+        const int nameIdx = elfRead4(&m_symbolSection[i].st_name);
 
         if (nameIdx == 0) { /* Silly symbols with no names */
             continue;
         }
 
-        const QString symbolName = getStrPtr(strSectionIdx, nameIdx);
-        // Hack off the "@@GLIBC_2.0" of Linux, if present
-        translatedSym.Name       = symbolName.left(symbolName.indexOf("@@"));
-        translatedSym.Type       = ELF32_ST_TYPE(m_symbolSection[i].st_info);
-        translatedSym.Binding    = ELF32_ST_BIND(m_symbolSection[i].st_info);
-        translatedSym.Visibility = ELF32_ST_VISIBILITY(m_symbolSection[i].st_other);
-        translatedSym.SymbolSize = m_symbolSection[i].st_size;
-        translatedSym.SectionIdx = elfRead2(&m_symbolSection[i].st_shndx);
-        translatedSym.Value      = val;
+        const ElfSymType type       = ELF32_ST_TYPE(m_symbolSection[i].st_info);
+        const ElfSymBinding binding = ELF32_ST_BIND(m_symbolSection[i].st_info);
 
-        if (translatedSym.Type == STT_FILE) {
-            fileName = translatedSym.Name;
+        if (type == STT_FILE) {
+            fileName = symbolNameFromStrTab(getStrPtr(strSectionIdx, nameIdx));
         }
 
-        if (translatedSym.Binding != STB_LOCAL && !fileName.isEmpty()) {
+        if (binding != STB_LOCAL && !fileName.isEmpty()) {
             // first non-local symbol, clear the current_file
             fileName.clear();
         }
 
-        processSymbol(translatedSym, symbolType, i, fileName);
+        // processSymbol ignores these, so do not bother converting the name
+        if (type == STT_FILE || (binding == STB_WEAK && type == STT_NOTYPE)) {
+            continue;
+        }
+
+        Translated_ElfSym translatedSym;
+        translatedSym.Name       = symbolNameFromStrTab(getStrPtr(strSectionIdx, nameIdx));
+        translatedSym.Type       = type;
+        translatedSym.Binding    = binding;
+        translatedSym.Visibility = ELF32_ST_VISIBILITY(m_symbolSection[i].st_other);
+        translatedSym.SymbolSize = m_symbolSection[i].st_size;
+        translatedSym.SectionIdx = elfRead2(&m_symbolSection[i].st_shndx);
+        translatedSym.Value      = Address(elfRead4(&m_symbolSection[i].st_value));
+
+        processSymbol(translatedSym, symbolType, i, hasPLT, fileName);
     }
 
     const Address addressOfMain = getMainEntryPoint();
@@ -670,10 +690,8 @@ void ElfBinaryLoader::addRelocsAsSyms(uint32_t relSecIdx)
             continue;
         }
 
-        QString symbolName = getStrPtr(strSecIdx, elfRead4(&m_symbolSection[symIndex].st_name));
-
-        // Hack off the "@@GLIBC_2.0" of Linux, if present
-        symbolName = symbolName.left(symbolName.indexOf("@@"));
+        const QString symbolName = symbolNameFromStrTab(
+            getStrPtr(strSecIdx, elfRead4(&m_symbolSection[symIndex].st_name)));
 
         const BinarySymbol *symbol = m_symbols->findSymbolByName(symbolName);
         // Add new extern
@@ -958,6 +976,8 @@ void ElfBinaryLoader::applyRelocations()
                                 ? Address(elfRead4(&assocSymbols[symbolIdx].st_value))
                                 : Address::ZERO;
 
+                m_binaryFile->addRelocation(P);
+
                 if (e_type == ET_REL && assocSymbols != nullptr) {
                     const Elf32_Half sectionIdx = elfRead2(&assocSymbols[symbolIdx].st_shndx);
 
@@ -1042,73 +1062,6 @@ void ElfBinaryLoader::applyRelocations()
 }
 
 
-bool ElfBinaryLoader::isRelocationAt(Address addr)
-{
-    if (m_loadedImage == nullptr) {
-        return false; // No file loaded
-    }
-
-    const Elf32_Half machine = elfRead2(&m_elfHeader->e_machine);
-    const Elf32_Half e_type  = elfRead2(&m_elfHeader->e_type); ///< relocation type
-
-    switch (machine) {
-    case EM_386:
-
-        for (size_t i = 1; i < m_elfSections.size(); ++i) {
-            const SectionParam &ps(m_elfSections[i]);
-
-            if (ps.sectionType == SHT_REL) {
-                // A section such as .rel.dyn or .rel.plt (without an addend field).
-                // Each entry has 2 words: r_offet and r_info. The r_offset is just the offset from
-                // the beginning of the section (section given by the section header's sh_info) to
-                // the word to be modified. r_info has the type in the bottom byte, and a symbol
-                // table index in the top 3 bytes. A symbol table offset of 0 (STN_UNDEF) means use
-                // value 0. The symbol table involved comes from the section header's sh_link field.
-                const Elf32_Rel *relocEntry = reinterpret_cast<Elf32_Rel *>(ps.imagePtr.value());
-                const DWord size            = ps.Size / sizeof(Elf32_Rel);
-
-                // NOTE: the r_offset is different for .o files (E_REL in the e_type header field)
-                // than for exe's and shared objects!
-                Address destNatOrigin = Address::ZERO;
-
-                if (e_type == ET_REL) {
-                    int destSection = m_shInfo[i];
-                    destNatOrigin   = m_elfSections[destSection].SourceAddr;
-                }
-
-                for (DWord u = 0; u < size; u++) {
-                    Elf32_Addr r_offset = elfRead4(&relocEntry[u].r_offset);
-
-                    Address relocDestination; // Pointer to the word to be relocated
-
-                    if (e_type == ET_REL) {
-                        relocDestination = destNatOrigin + r_offset;
-                    }
-                    else {
-                        const BinarySection *destSec = m_binaryFile->getImage()->getSectionByAddr(
-                            Address(r_offset));
-                        if (destSec) {
-                            relocDestination = destSec->getSourceAddr() + r_offset;
-                            destNatOrigin    = Address::ZERO;
-                        }
-                    }
-
-                    if (addr == relocDestination) {
-                        return true;
-                    }
-                }
-            }
-        }
-
-        break;
-
-    default: LOG_WARN("Unhandled relocation!"); break; // Not implemented yet
-    }
-
-    return false;
-}
-
-
 int ElfBinaryLoader::canLoad(QIODevice &fl) const
 {
     const QByteArray contents = fl.read(sizeof(Elf32_Ehdr));
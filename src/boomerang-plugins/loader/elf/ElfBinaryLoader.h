@@ -67,9 +67,6 @@ public:
     /// \copydoc IFileLoader::getEntryPoint
     Address getEntryPoint() override;
 
-    /// \copydoc IFileLoader::isRelocationAt
-    bool isRelocationAt(Address addr) override;
-
 private:
     /// Reset internal state, except for those that keep track of which member
     /// we're up to
@@ -126,7 +123,8 @@ private:
      */
     void markImports();
 
-    void processSymbol(Translated_ElfSym &sym, int e_type, int i, const QString &currentFile = "");
+    void processSymbol(Translated_ElfSym &sym, int e_type, int i, bool hasPLT,
+                       const QString &currentFile = "");
 
 private:
     size_t m_loadedImageSize = 0;       ///< Size of image in bytes
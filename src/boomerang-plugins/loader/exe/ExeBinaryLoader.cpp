@@ -34,8 +34,9 @@ ExeBinaryLoader::ExeBinaryLoader(Project *project)
 
 void ExeBinaryLoader::initialize(BinaryFile *file, BinarySymbolTable *symbols)
 {
-    m_image   = file->getImage();
-    m_symbols = symbols;
+    m_binaryFile = file;
+    m_image      = file->getImage();
+    m_symbols    = symbols;
 
     // We can only load MZ executables, which are always 16 bit exetuables.
     file->setBitness(16);
@@ -196,6 +197,7 @@ bool ExeBinaryLoader::applyRelocations(QBuffer &fp, QByteArray &data, Address lo
         Byte *p                = &m_loadedImage[imageOffset];
         const SWord relocValue = Util::readWord(p, Endian::Little);
         Util::writeWord(p, loadBaseAddr.value() + relocValue, Endian::Little);
+        m_binaryFile->addRelocation(loadBaseAddr + imageOffset);
     }
 
     Address relocStart   = loadBaseAddr + m_imageSize + sizeof(ExeHeader);
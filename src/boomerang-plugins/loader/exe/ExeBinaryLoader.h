@@ -102,6 +102,7 @@ private:
     Address m_uInitPC = Address::INVALID; ///< Initial program counter (relative to m_loadAddr)
     Address m_uInitSP = Address::INVALID; ///< Initial stack pointer
 
+    BinaryFile *m_binaryFile     = nullptr;
     BinaryImage *m_image         = nullptr;
     BinarySymbolTable *m_symbols = nullptr;
 };
@@ -71,6 +71,10 @@ struct SectionParam
 #define IMAGE_SCN_MEM_READ                  0x40000000
 #define IMAGE_SCN_MEM_WRITE                 0x80000000
 #endif
+
+#ifndef IMAGE_REL_BASED_HIGHLOW
+#define IMAGE_REL_BASED_HIGHLOW             3
+#endif
 // clang-format on
 
 
@@ -83,6 +87,7 @@ Win32BinaryLoader::Win32BinaryLoader(Project *project)
     , m_numRelocs(0)
     , m_hasDebugInfo(false)
     , m_mingwMain(false)
+    , m_binaryFile(nullptr)
     , m_binaryImage(nullptr)
     , m_symbols(nullptr)
 {
@@ -98,6 +103,7 @@ Win32BinaryLoader::~Win32BinaryLoader()
 void Win32BinaryLoader::initialize(BinaryFile *file, BinarySymbolTable *symbols)
 {
     unload();
+    m_binaryFile  = file;
     m_binaryImage = file->getImage();
     m_symbols     = symbols;
 
@@ -715,6 +721,7 @@ bool Win32BinaryLoader::loadFromMemory(QByteArray &arr)
 
     // Add the Import Address Table entries to the symbol table
     processIAT();
+    processBaseRelocations();
 
     // Was hoping that _main or main would turn up here for Borland console mode programs. No such
     // luck. I think IDA Pro must find it by a combination of FLIRT and some pattern matching
@@ -824,6 +831,48 @@ void Win32BinaryLoader::findJumps(Address curr)
 }
 
 
+void Win32BinaryLoader::processBaseRelocations()
+{
+    const DWord fixupRVA  = READ4_LE(m_peHeader->FixupTableRVA);
+    const DWord fixupSize = READ4_LE(m_peHeader->TotalFixupDataSize);
+
+    if (fixupRVA == 0 || fixupSize == 0 || fixupRVA > m_imageSize ||
+        fixupSize > m_imageSize - fixupRVA) {
+        return;
+    }
+
+    const Address imageBase = Address(READ4_LE(m_peHeader->Imagebase));
+    const Byte *fixups      = reinterpret_cast<const Byte *>(m_image + fixupRVA);
+
+    // Each block covers one page. It starts with the page RVA and the size of the block,
+    // followed by 16 bit entries with the type in the top 4 bits and the page offset
+    // in the lower 12 bits.
+    DWord offset = 0;
+    while (offset + 8 <= fixupSize) {
+        const Byte *block     = fixups + offset;
+        const DWord pageRVA   = Util::readDWord(block, Endian::Little);
+        const DWord blockSize = Util::readDWord(block + 4, Endian::Little);
+
+        if (blockSize < 8 || blockSize > fixupSize - offset) {
+            LOG_WARN("Invalid base relocation block at address %1",
+                     imageBase + fixupRVA + offset);
+            break;
+        }
+
+        for (DWord i = 8; i + 2 <= blockSize; i += 2) {
+            const SWord value = Util::readWord(block + i, Endian::Little);
+
+            if ((value >> 12) == IMAGE_REL_BASED_HIGHLOW) {
+                m_binaryFile->addRelocation(imageBase + pageRVA + (value & 0x0FFF));
+                m_numRelocs++;
+            }
+        }
+
+        offset += blockSize;
+    }
+}
+
+
 void Win32BinaryLoader::unload()
 {
     m_imageSize = 0;
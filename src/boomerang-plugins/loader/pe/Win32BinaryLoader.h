@@ -206,6 +206,9 @@ public:
 
 protected:
     void processIAT();
+
+    /// Adds the destinations of all base relocations (.reloc) to the relocation index
+    void processBaseRelocations();
     void readDebugData(QString exename);
 
 private:
@@ -222,6 +225,7 @@ private:
     bool m_hasDebugInfo;
     bool m_mingwMain;
 
+    BinaryFile *m_binaryFile;
     BinaryImage *m_binaryImage;
     BinarySymbolTable *m_symbols;
 };
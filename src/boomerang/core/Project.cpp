@@ -19,6 +19,8 @@
 #include "boomerang/util/ProgSymbolWriter.h"
 #include "boomerang/util/log/Log.h"
 
+#include <QBuffer>
+
 
 Project::Project()
     : m_settings(new Settings())
@@ -108,8 +110,18 @@ bool Project::loadBinaryFile(const QString &filePath)
 {
     LOG_MSG("Loading binary file '%1'", filePath);
 
+    // Read the file only once; both loader selection and loading work on the same bytes
+    QFile srcFile(filePath);
+    if (!srcFile.open(QFile::ReadOnly)) {
+        LOG_WARN("Opening '%1' failed", filePath);
+        return false;
+    }
+
+    const QByteArray data = srcFile.readAll();
+    srcFile.close();
+
     // Find loader plugin to load file
-    IFileLoader *loader = getBestLoader(filePath);
+    IFileLoader *loader = getBestLoader(data);
 
     if (loader == nullptr) {
         LOG_WARN("Cannot load '%1': Unrecognized binary file format.", filePath);
@@ -121,19 +133,14 @@ bool Project::loadBinaryFile(const QString &filePath)
         unloadBinaryFile();
     }
 
-    QFile srcFile(filePath);
-    if (!srcFile.open(QFile::ReadOnly)) {
-        LOG_WARN("Opening '%1' failed");
-        return false;
-    }
-
-    m_loadedBinary.reset(new BinaryFile(srcFile.readAll(), loader));
+    m_loadedBinary.reset(new BinaryFile(data, loader));
 
     if (loader->loadFromFile(m_loadedBinary.get()) == false) {
         return false;
     }
 
     m_loadedBinary->getImage()->updateTextLimits();
+    m_loadedBinary->getImage()->freeze();
 
     return createProg(m_loadedBinary.get(), QFileInfo(filePath).baseName()) != nullptr;
 }
@@ -239,7 +246,9 @@ bool Project::generateCode(Module *module)
     LOG_MSG("Generating code...");
     for (auto &plugin : m_pluginManager->getPluginsByType(PluginType::CodeGenerator)) {
         ICodeGenerator *gen = plugin->getIfc<ICodeGenerator>();
-        gen->generateCode(getProg(), module);
+        if (gen) {
+            gen->generateCode(getProg(), module);
+        }
     }
 
     return true;
@@ -284,7 +293,10 @@ IFrontEnd *Project::createFrontEnd()
         }
 
         IFrontEnd *fe = plugin->getIfc<IFrontEnd>();
-        if (!fe->initialize(this)) {
+        if (!fe) {
+            throw std::runtime_error("Plugin initialization failed.");
+        }
+        else if (!fe->initialize(this)) {
             throw std::runtime_error("FrontEnd initialization failed.");
         }
         return fe;
@@ -516,12 +528,13 @@ void Project::alertDecompilationEnd()
 }
 
 
-IFileLoader *Project::getBestLoader(const QString &filePath) const
+IFileLoader *Project::getBestLoader(const QByteArray &data) const
 {
-    QFile inputBinary(filePath);
+    // The buffer shares the contents of data, so probing the loaders does not copy the file.
+    QBuffer inputBinary;
+    inputBinary.setData(data);
 
-    if (!inputBinary.open(QFile::ReadOnly)) {
-        LOG_ERROR("Unable to open binary file: %1", filePath);
+    if (!inputBinary.open(QBuffer::ReadOnly)) {
         return nullptr;
     }
 
@@ -532,6 +545,9 @@ IFileLoader *Project::getBestLoader(const QString &filePath) const
     for (Plugin *p : m_pluginManager->getPluginsByType(PluginType::FileLoader)) {
         inputBinary.seek(0); // reset the file offset for the next plugin
         IFileLoader *loader = p->getIfc<IFileLoader>();
+        if (!loader) {
+            continue;
+        }
 
         int score = loader->canLoad(inputBinary);
 
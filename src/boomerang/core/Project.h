@@ -174,8 +174,8 @@ public:
     void alertDecompilationEnd();
 
 private:
-    /// Get the best loader that is able to load the file at \p filePath
-    IFileLoader *getBestLoader(const QString &filePath) const;
+    /// Get the best loader that is able to load the binary file contents \p data
+    IFileLoader *getBestLoader(const QByteArray &data) const;
 
     /**
      * Create a Prog from a loaded binary file. Returns nullptr on failure.
@@ -9,20 +9,27 @@
 #pragma endregion License
 #include "Plugin.h"
 
+#include "boomerang/util/log/Log.h"
+
 
 Plugin::Plugin(Project *project, const QString &pluginPath)
-    : m_pluginHandle(pluginPath)
+    : m_project(project)
+    , m_pluginHandle(pluginPath)
     , m_ifc(nullptr)
+    , m_initFailed(false)
 {
-    if (!init(project)) {
-        throw std::runtime_error("Plugin initialization failed!");
+    if (!getInfo()) {
+        throw std::runtime_error("Plugin information not found!");
     }
 }
 
 
 Plugin::~Plugin()
 {
-    deinit();
+    if (isInitialized()) {
+        deinit();
+    }
+
     // library is automatically unloaded
 }
 
@@ -39,20 +46,26 @@ const PluginInfo *Plugin::getInfo() const
 }
 
 
-bool Plugin::init(Project *project)
+void *Plugin::getInterface() const
 {
-    const PluginInfo *info = getInfo();
-    if (!info) {
-        return false;
+    if (!m_ifc && !m_initFailed && !init()) {
+        LOG_ERROR("Initialization of plugin '%1' failed!", getInfo()->name);
+        m_initFailed = true;
     }
 
+    return m_ifc;
+}
+
+
+bool Plugin::init() const
+{
     assert(m_ifc == nullptr);
     PluginInitFunction initFunction = getFunction<PluginInitFunction>("initPlugin");
     if (!initFunction) {
         return false;
     }
 
-    m_ifc = initFunction(project);
+    m_ifc = initFunction(m_project);
     return m_ifc != nullptr;
 }
 
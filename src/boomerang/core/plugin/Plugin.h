@@ -36,6 +36,10 @@ struct PluginInfo
  *   - void deinitPlugin(): to deinitialize the plugin and free resources.
  *   - const PluginInfo* getInfo(): To get information about the plugin.
  *     May be called before initPlugin().
+ *
+ * Loading the library only queries the plugin information. The plugin itself is initialized
+ * when its interface is first requested, so plugins that are not needed for the current binary
+ * (e.g. decoders for other architectures) never allocate their resources.
  */
 class Plugin
 {
@@ -45,6 +49,7 @@ class Plugin
 
 public:
     /// Create a plugin from a dynamic library file.
+    /// The plugin is not initialized until its interface is requested.
     /// \param pluginPath path to the library file.
     explicit Plugin(Project *project, const QString &pluginPath);
 
@@ -60,21 +65,29 @@ public:
     /// Get information about the plugin.
     const PluginInfo *getInfo() const;
 
+    /// \returns true if the plugin has been initialized successfully.
+    bool isInitialized() const { return m_ifc != nullptr; }
+
+    /// Get the plugin interface, initializing the plugin if necessary.
+    /// \returns nullptr if the plugin could not be initialized.
     template<typename IFC>
     IFC *getIfc()
     {
-        return static_cast<IFC *>(m_ifc);
+        return static_cast<IFC *>(getInterface());
     }
 
     template<typename IFC>
     const IFC *getIfc() const
     {
-        return static_cast<const IFC *>(m_ifc);
+        return static_cast<const IFC *>(getInterface());
     }
 
 private:
+    /// \returns the interface pointer, initializing the plugin on first use.
+    void *getInterface() const;
+
     /// Initialize the plugin.
-    bool init(Project *project);
+    bool init() const;
 
     /// De-initialize the plugin.
     bool deinit();
@@ -95,8 +108,10 @@ private:
     }
 
 private:
+    Project *m_project;
     PluginHandle m_pluginHandle; ///< handle to the dynamic library
-    void *m_ifc;                 ///< Interface pointer (e.g. IDecoder * for decoder plugins)
+    mutable void *m_ifc;         ///< Interface pointer (e.g. IDecoder * for decoder plugins)
+    mutable bool m_initFailed;   ///< true if initializing the plugin failed; do not try again
 };
 
 
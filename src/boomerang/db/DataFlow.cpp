@@ -286,20 +286,7 @@ bool DataFlow::placePhiFunctions()
     m_bucket.resize(0);
     m_defsites.clear();
     m_defallsites.clear();
-
-    for (ExSet &exps : m_definedAt) {
-        for (auto iter = exps.begin(); iter != exps.end();) {
-            if (m_A_phi.find(*iter) == m_A_phi.end()) {
-                iter = exps.erase(iter);
-            }
-            else {
-                ++iter;
-            }
-        }
-    }
-
-    m_definedAt.clear(); // and A_orig,
-    m_defStmts.clear();  // and the map from variable to defining Stmt
+    m_definedAt.clear(); // and A_orig
 
     for (IRFragment *frag : *m_proc->getCFG()) {
         frag->clearPhis();
@@ -333,9 +320,8 @@ bool DataFlow::placePhiFunctions()
             }
 
             for (const SharedExp &exp : locationSet) {
-                if (canRename(exp)) {
+                if (canRename(exp) && !m_definedAt[n].contains(exp)) {
                     m_definedAt[n].insert(exp->clone());
-                    m_defStmts[exp] = stmt;
                 }
             }
         }
@@ -360,6 +346,7 @@ bool DataFlow::placePhiFunctions()
 
     // For each variable a defined anywhere
     for (auto &[a, defsites] : m_defsites) {
+        auto phiSites         = m_A_phi.find(a);
         std::set<FragIndex> W = defsites;
 
         while (!W.empty()) {
@@ -369,7 +356,7 @@ bool DataFlow::placePhiFunctions()
 
             for (FragIndex y : m_DF[n]) {
                 // phi function already created for y?
-                if (m_A_phi[a].find(y) != m_A_phi[a].end()) {
+                if (phiSites != m_A_phi.end() && phiSites->second.count(y) > 0) {
                     continue;
                 }
 
@@ -378,7 +365,11 @@ bool DataFlow::placePhiFunctions()
                 m_frags[y]->addPhi(a->clone());
 
                 // A_phi[a] <- A_phi[a] U {y}
-                m_A_phi[a].insert(y);
+                if (phiSites == m_A_phi.end()) {
+                    phiSites = m_A_phi.insert({ a, {} }).first;
+                }
+
+                phiSites->second.insert(y);
 
                 // if a !elementof A_orig[y]
                 if (!m_definedAt[y].contains(a)) {
@@ -455,7 +446,6 @@ void DataFlow::allocateData()
     m_A_phi.clear();
     m_defsites.clear();
     m_defallsites.clear();
-    m_defStmts.clear();
 
     // Set up the fragment and indices vectors.
     // Do this here because sometimes a fragment can be unreachable
@@ -172,9 +172,6 @@ private:
     /// Set of block numbers defining all variables
     std::set<FragIndex> m_defallsites;
 
-    /// A Boomerang requirement: Statements defining particular subscripted locations
-    std::map<SharedExp, SharedStmt, lessExpStar> m_defStmts;
-
     /**
      * Initially false, meaning that locals and parameters are not renamed and hence not propagated.
      * When true, locals and parameters can be renamed if their address does not escape the local
@@ -69,23 +69,6 @@ SharedExp DefCollector::findDefFor(const SharedExp &e) const
 }
 
 
-void DefCollector::updateDefs(std::map<SharedExp, std::stack<SharedStmt>, lessExpStar> &Stacks,
-                              UserProc *proc)
-{
-    for (auto &Stack : Stacks) {
-        if (Stack.second.empty()) {
-            continue; // This variable's definition doesn't reach here
-        }
-
-        // Create an assignment of the form loc := loc{def}
-        auto re = RefExp::get(Stack.first->clone(), Stack.second.top());
-        std::shared_ptr<Assign> as(new Assign(Stack.first->clone(), re));
-        as->setProc(proc); // Simplify sometimes needs this
-        collectDef(as);
-    }
-}
-
-
 void DefCollector::searchReplaceAll(const Exp &from, SharedExp to, bool &changed)
 {
     for (auto def : m_defs) {
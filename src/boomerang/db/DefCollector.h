@@ -64,11 +64,6 @@ public:
     /// If not found, returns nullptr.
     SharedExp findDefFor(const SharedExp &e) const;
 
-    /// Update the definitions with the current set of reaching definitions
-    /// \p proc is the enclosing procedure
-    void updateDefs(std::map<SharedExp, std::stack<SharedStmt>, lessExpStar> &Stacks,
-                    UserProc *proc);
-
     /// Search and replace all occurrences
     void searchReplaceAll(const Exp &pattern, SharedExp replacement, bool &change);
 
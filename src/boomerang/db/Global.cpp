@@ -120,20 +120,8 @@ SharedExp Global::readInitialValue(Address uaddr, SharedType type) const
     }
 
     if (type->resolvesToArray()) {
-        const int baseSize = type->as<ArrayType>()->getBaseType()->getSize() / 8;
-        int numElements    = type->as<ArrayType>()->getLength();
-
-        if ((numElements <= 0 || numElements == ARRAY_UNBOUNDED) && baseSize > 0) {
-            // try to read number of elements from information
-            // contained in the binary file
-            QString symbolName = m_prog->getGlobalNameByAddr(uaddr);
-
-            if (!symbolName.isEmpty()) {
-                BinarySymbol *symbol = m_prog->getBinaryFile()->getSymbols()->findSymbolByName(
-                    symbolName);
-                numElements = (symbol ? symbol->getSize() : 0) / baseSize;
-            }
-        }
+        const int baseSize    = type->as<ArrayType>()->getBaseType()->getSize() / 8;
+        const int numElements = getArrayLength(uaddr, type->as<ArrayType>());
 
         // It makes no sense to read an array with unknown upper bound
         if (numElements <= 0 || numElements == ARRAY_UNBOUNDED) {
@@ -219,6 +207,70 @@ SharedExp Global::readInitialValue(Address uaddr, SharedType type) const
 }
 
 
+bool Global::getInitialIntArray(InitialIntArray &result) const
+{
+    // Only real arrays are declared as arrays by the code generator, not named array types
+    if (!m_type->isArray()) {
+        return false;
+    }
+
+    std::shared_ptr<const ArrayType> arrayType = m_type->as<ArrayType>();
+    SharedConstType baseType                   = arrayType->getBaseType();
+
+    if (baseType->resolvesToChar() ||
+        !(baseType->resolvesToInteger() || baseType->resolvesToSize())) {
+        return false;
+    }
+
+    const int elementSize = baseType->getSize() / 8;
+    if (elementSize != 1 && elementSize != 2 && elementSize != 4) {
+        return false;
+    }
+
+    const int numElements = getArrayLength(m_addr, arrayType);
+    if (numElements <= 0 || numElements == ARRAY_UNBOUNDED) {
+        return false;
+    }
+
+    const Address endAddr     = m_addr + numElements * elementSize;
+    const BinarySection *sect = m_prog->getSectionByAddr(m_addr);
+
+    if (!sect || sect->getHostAddr() == HostAddress::INVALID ||
+        endAddr > sect->getSourceAddr() + sect->getSize() || sect->isAddressBss(m_addr) ||
+        sect->isAddressBss(endAddr - 1)) {
+        return false;
+    }
+
+    result.data = reinterpret_cast<const Byte *>(
+        (sect->getHostAddr() - sect->getSourceAddr() + m_addr).value());
+    result.numElements = numElements;
+    result.elementSize = elementSize;
+    result.endian      = sect->getEndian();
+    return true;
+}
+
+
+int Global::getArrayLength(Address addr, const std::shared_ptr<const ArrayType> &ty) const
+{
+    const int baseSize = ty->getBaseType()->getSize() / 8;
+    int numElements    = ty->getLength();
+
+    if ((numElements <= 0 || numElements == ARRAY_UNBOUNDED) && baseSize > 0) {
+        // try to read number of elements from information
+        // contained in the binary file
+        QString symbolName = m_prog->getGlobalNameByAddr(addr);
+
+        if (!symbolName.isEmpty()) {
+            BinarySymbol *symbol = m_prog->getBinaryFile()->getSymbols()->findSymbolByName(
+                symbolName);
+            numElements = (symbol ? symbol->getSize() : 0) / baseSize;
+        }
+    }
+
+    return numElements;
+}
+
+
 void Global::meetType(SharedType ty)
 {
     bool ch = false;
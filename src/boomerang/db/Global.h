@@ -12,10 +12,22 @@
 
 #include "boomerang/ssl/type/Type.h"
 #include "boomerang/util/Address.h"
+#include "boomerang/util/ByteUtil.h"
 #include "boomerang/util/Util.h"
 
 
 class Prog;
+class ArrayType;
+
+
+/// Raw initial data of a global array of integers. \sa Global::getInitialIntArray
+struct InitialIntArray
+{
+    const Byte *data = nullptr; ///< Host pointer to the first element
+    int numElements  = 0;
+    int elementSize  = 0; ///< Size of a single element in bytes
+    Endian endian    = Endian::Little;
+};
 
 
 /**
@@ -47,9 +59,21 @@ public:
     /// Get the initial value as an expression (or nullptr if not initialised)
     SharedExp getInitialValue() const;
 
+    /**
+     * Get the initial value of an array of 8, 16 or 32 bit integers directly from the image,
+     * without creating an expression for every element.
+     * \returns false if this global is not such an array, or if the array data does not lie
+     * completely within a single initialized section. Use \ref getInitialValue in this case.
+     */
+    bool getInitialIntArray(InitialIntArray &result) const;
+
 private:
     SharedExp readInitialValue(Address addr, SharedType ty) const;
 
+    /// \returns the number of elements of the array of type \p ty at address \p addr,
+    /// taking the symbol size into account if the length of \p ty is unknown.
+    int getArrayLength(Address addr, const std::shared_ptr<const ArrayType> &ty) const;
+
 private:
     SharedType m_type;
     Address m_addr;
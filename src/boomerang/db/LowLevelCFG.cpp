@@ -213,6 +213,13 @@ bool LowLevelCFG::isStartOfCompleteBB(Address addr) const
 }
 
 
+Address LowLevelCFG::getNextBBStartAfter(Address addr) const
+{
+    BBStartMap::const_iterator it = m_bbStartMap.upper_bound(addr);
+    return (it != m_bbStartMap.end()) ? it->first : Address::INVALID;
+}
+
+
 void LowLevelCFG::removeBB(BasicBlock *bb)
 {
     if (bb == nullptr) {
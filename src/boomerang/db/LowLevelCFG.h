@@ -133,6 +133,10 @@ public:
     /// Check if the given address is the start of a complete basic block.
     bool isStartOfCompleteBB(Address addr) const;
 
+    /// \returns the start address of the first basic block starting after \p addr,
+    /// or Address::INVALID if there is no such basic block.
+    Address getNextBBStartAfter(Address addr) const;
+
     /// Completely removes a single BB from this CFG.
     /// \note \p bb is invalid after this function returns.
     void removeBB(BasicBlock *bb);
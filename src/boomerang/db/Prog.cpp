@@ -33,6 +33,7 @@
 #include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
 #include "boomerang/ssl/exp/Terminal.h"
+#include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/type/ArrayType.h"
 #include "boomerang/ssl/type/CharType.h"
 #include "boomerang/ssl/type/FloatType.h"
@@ -352,12 +353,13 @@ void Prog::readDefaultLibraryCatalogues()
 
     const QDir dataDir = m_project->getSettings()->getDataDirectory();
     Plugin *plugin     = m_project->getPluginManager()->getPluginByName("C Symbol Provider plugin");
-    if (!plugin) {
+
+    ISymbolProvider *prov = plugin ? plugin->getIfc<ISymbolProvider>() : nullptr;
+    if (!prov) {
         LOG_ERROR("Symbol provider plugin not found!");
         return;
     }
 
-    ISymbolProvider *prov = plugin->getIfc<ISymbolProvider>();
     prov->readLibraryCatalog(this, dataDir.absoluteFilePath("signatures/common.hs"));
 
     QString libCatalogName;
@@ -386,11 +388,12 @@ void Prog::readDefaultLibraryCatalogues()
 bool Prog::addSymbolsFromSymbolFile(const QString &fname)
 {
     Plugin *plugin = m_project->getPluginManager()->getPluginByName("C Symbol Provider plugin");
-    if (!plugin) {
+
+    ISymbolProvider *prov = plugin ? plugin->getIfc<ISymbolProvider>() : nullptr;
+    if (!prov) {
         return false;
     }
 
-    ISymbolProvider *prov = plugin->getIfc<ISymbolProvider>();
     return prov->addSymbolsFromSymbolFile(this, fname);
 }
 
@@ -400,8 +403,9 @@ std::shared_ptr<Signature> Prog::getLibSignature(const QString &name)
     Plugin *plugin = m_project->getPluginManager()->getPluginByName("C Symbol Provider plugin");
     std::shared_ptr<Signature> signature = nullptr;
 
-    if (plugin) {
-        signature = plugin->getIfc<ISymbolProvider>()->getSignatureByName(name);
+    ISymbolProvider *prov = plugin ? plugin->getIfc<ISymbolProvider>() : nullptr;
+    if (prov) {
+        signature = prov->getSignatureByName(name);
     }
 
     if (signature) {
@@ -501,6 +505,19 @@ bool Prog::getFloatConstant(Address addr, double &value, int bits) const
 }
 
 
+const std::vector<SharedType> &Prog::getFormatStringArgTypes(const QString &fmtStr, bool isScanf)
+{
+    std::map<QString, std::vector<SharedType>> &cache = m_fmtStrArgTypes[isScanf ? 1 : 0];
+
+    auto it = cache.find(fmtStr);
+    if (it == cache.end()) {
+        it = cache.insert({ fmtStr, CallStatement::parseFmtStr(fmtStr, isScanf) }).first;
+    }
+
+    return it->second;
+}
+
+
 QString Prog::getSymbolNameByAddr(Address dest) const
 {
     if (m_binaryFile == nullptr) {
@@ -25,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 
 class ArrayType;
@@ -169,6 +170,10 @@ public:
     const char *getStringConstant(Address addr, bool knownString = false) const;
     bool getFloatConstant(Address addr, double &value, int bits = 64) const;
 
+    /// \returns the types of the arguments consumed by the printf or scanf style
+    /// format string \p fmtStr. Each format string is parsed only once per program.
+    const std::vector<SharedType> &getFormatStringArgTypes(const QString &fmtStr, bool isScanf);
+
     /// Get a symbol from an address
     QString getSymbolNameByAddr(Address dest) const;
 
@@ -264,4 +269,7 @@ private:
     // FIXME: is a set of Globals the most appropriate data structure? Surely not.
     GlobalSet m_globals;         ///< globals to print at code generation time
     DataIntervalMap m_globalMap; ///< Map from address to DataInterval (has size, name, type)
+
+    /// Argument types of all parsed format strings (printf style, scanf style)
+    std::map<QString, std::vector<SharedType>> m_fmtStrArgTypes[2];
 };
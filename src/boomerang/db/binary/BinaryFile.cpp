@@ -77,7 +77,13 @@ Address BinaryFile::getMainEntryPoint() const
 
 bool BinaryFile::isRelocationAt(Address addr) const
 {
-    return m_loader ? m_loader->isRelocationAt(addr) : false;
+    return m_relocations.find(addr.value()) != m_relocations.end();
+}
+
+
+void BinaryFile::addRelocation(Address addr)
+{
+    m_relocations.insert(addr.value());
 }
 
 
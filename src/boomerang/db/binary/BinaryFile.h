@@ -13,6 +13,7 @@
 #include "boomerang/util/Address.h"
 
 #include <memory>
+#include <unordered_set>
 
 
 class BinaryImage;
@@ -86,6 +87,10 @@ public:
     /// \returns true if \p addr is the destination of a relocated symbol.
     bool isRelocationAt(Address addr) const;
 
+    /// Marks \p addr as the destination of a relocation.
+    /// Called by the loaders while applying or reading relocations.
+    void addRelocation(Address addr);
+
     /// \returns the destination of a jump at address \p addr, taking relocation into account
     Address getJumpTarget(Address addr) const;
 
@@ -104,4 +109,7 @@ private:
 
     IFileLoader *m_loader = nullptr;
     int m_bitness         = 0;
+
+    /// Destination addresses of all relocations
+    std::unordered_set<Address::value_type> m_relocations;
 };
@@ -31,11 +31,44 @@ BinaryImage::~BinaryImage()
 
 void BinaryImage::reset()
 {
+    m_sectionIndex.clear();
+    m_frozen = false;
+
     m_sectionMap.clear();
     m_sections.clear();
 }
 
 
+void BinaryImage::freeze()
+{
+    // Split the address space at each section boundary. The section containing an address
+    // is the same for all addresses between two adjacent boundaries.
+    std::vector<Address> bounds;
+    bounds.reserve(2 * m_sections.size());
+
+    for (auto it = m_sectionMap.begin(); it != m_sectionMap.end(); ++it) {
+        bounds.push_back(it->first.lower());
+        bounds.push_back(it->first.upper());
+    }
+
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    m_sectionIndex.clear();
+
+    for (const Address &from : bounds) {
+        auto it                = m_sectionMap.find(from);
+        BinarySection *section = (it != m_sectionMap.end()) ? it->second.get() : nullptr;
+
+        if (m_sectionIndex.empty() || m_sectionIndex.back().section != section) {
+            m_sectionIndex.push_back({ from, section });
+        }
+    }
+
+    m_frozen = true;
+}
+
+
 bool BinaryImage::readNative1(Address addr, Byte &value) const
 {
     const BinarySection *section = getSectionByAddr(addr);
@@ -189,6 +222,11 @@ bool BinaryImage::readNativeFloat8(Address addr, double &value) const
 
 bool BinaryImage::writeNative4(Address addr, uint32_t value)
 {
+    if (m_frozen) {
+        LOG_WARN("Ignoring write at address %1: Image is read-only", addr);
+        return false;
+    }
+
     BinarySection *si = getSectionByAddr(addr);
 
     if (si == nullptr || si->getHostAddr() == HostAddress::INVALID) {
@@ -284,7 +322,11 @@ Interval<Address> BinaryImage::getLimitText() const
 
 BinarySection *BinaryImage::createSection(const QString &name, Address from, Address to)
 {
-    if (from == Address::INVALID || to == Address::INVALID || to < from) {
+    if (m_frozen) {
+        LOG_ERROR("Could not create section '%1': Image is read-only", name);
+        return nullptr;
+    }
+    else if (from == Address::INVALID || to == Address::INVALID || to < from) {
         LOG_ERROR("Could not create section '%1' with invalid extent [%2, %3)", name, from, to);
         return nullptr;
     }
@@ -379,13 +421,21 @@ const BinarySection *BinaryImage::getSectionByName(const QString &sectionName) c
 
 BinarySection *BinaryImage::getSectionByAddr(Address addr)
 {
-    auto iter = m_sectionMap.find(addr);
-    return (iter != m_sectionMap.end()) ? iter->second.get() : nullptr;
+    const BinaryImage *constThis = this;
+    return const_cast<BinarySection *>(constThis->getSectionByAddr(addr));
 }
 
 
 const BinarySection *BinaryImage::getSectionByAddr(Address addr) const
 {
+    if (m_frozen) {
+        auto it = std::upper_bound(
+            m_sectionIndex.begin(), m_sectionIndex.end(), addr,
+            [](const Address &a, const SectionIndexEntry &entry) { return a < entry.from; });
+
+        return (it != m_sectionIndex.begin()) ? std::prev(it)->section : nullptr;
+    }
+
     auto iter = m_sectionMap.find(addr);
     return (iter != m_sectionMap.end()) ? iter->second.get() : nullptr;
 }
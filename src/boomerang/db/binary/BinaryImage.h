@@ -71,6 +71,16 @@ public:
     /// Removes all sections from this image.
     void reset();
 
+    /**
+     * Marks the image as completely loaded. Afterwards, no sections can be created
+     * and the image cannot be written to, so the image can be read from multiple threads
+     * without synchronization. Also speeds up section lookup by address.
+     */
+    void freeze();
+
+    /// \returns true if the image has been frozen, see \ref freeze
+    bool isFrozen() const { return m_frozen; }
+
     /// Creates a new section with name \p name between \p from and \p to
     /// \returns the new section, or nullptr on failure.
     BinarySection *createSection(const QString &name, Address from, Address to);
@@ -128,4 +138,15 @@ private:
 
     SectionList m_sections; ///< The section info
     IntervalMap<Address, std::unique_ptr<BinarySection>> m_sectionMap;
+
+    /// Start address of each maximal address range that is mapped to the same section
+    /// (or to no section, if section == nullptr), sorted by address. Only valid if frozen.
+    struct SectionIndexEntry
+    {
+        Address from;
+        BinarySection *section;
+    };
+
+    std::vector<SectionIndexEntry> m_sectionIndex;
+    bool m_frozen = false;
 };
@@ -38,6 +38,9 @@ class BOOMERANG_API BinarySymbolTable
     typedef SymbolList::reverse_iterator reverse_iterator;
     typedef SymbolList::const_reverse_iterator const_reverse_iterator;
 
+public:
+    typedef std::map<Address, std::shared_ptr<BinarySymbol>> AddrIndex;
+
 public:
     BinarySymbolTable();
     BinarySymbolTable(const BinarySymbolTable &other) = delete;
@@ -70,6 +73,10 @@ public:
     BinarySymbol *findSymbolByAddress(Address addr);
     const BinarySymbol *findSymbolByAddress(Address addr) const;
 
+    /// \returns all symbols indexed by address. Unlike iterating over the table, this also
+    /// includes addresses that \ref createSymbol redirected to an existing symbol of the same name.
+    const AddrIndex &getAddrIndex() const { return m_addrIndex; }
+
     BinarySymbol *findSymbolByName(const QString &name);
     const BinarySymbol *findSymbolByName(const QString &name) const;
 
@@ -78,7 +85,7 @@ public:
 
 private:
     /// The map indexed by address.
-    std::map<Address, std::shared_ptr<BinarySymbol>> m_addrIndex;
+    AddrIndex m_addrIndex;
 
     /// The map indexed by string. Note that the strings are stored twice.
     std::map<QString, std::shared_ptr<BinarySymbol>> m_nameIndex;
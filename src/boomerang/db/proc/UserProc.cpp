@@ -34,6 +34,8 @@
 #include "boomerang/visitor/expmodifier/ExpSubscriptReplacer.h"
 #include "boomerang/visitor/stmtmodifier/StmtSubscriptReplacer.h"
 
+#include <algorithm>
+
 
 bool lessUserProc::operator()(const UserProc *lhs, const UserProc *rhs) const
 {
@@ -143,6 +145,9 @@ void UserProc::numberStatements() const
             s->setNumber(++stmtNumber);
         }
     }
+
+    // Statements that are not in the CFG keep their numbers, so don't reuse them
+    m_lastStmtNumber = std::max(m_lastStmtNumber, stmtNumber);
 }
 
 
@@ -273,6 +278,46 @@ bool UserProc::insertStatementAfter(const SharedStmt &afterThis, const SharedStm
 }
 
 
+bool UserProc::insertStatementsAfter(const StmtInsertionMap &insertions)
+{
+    std::set<IRFragment *> frags;
+
+    for (const auto &[afterThis, stmts] : insertions) {
+        Q_UNUSED(stmts);
+        assert(afterThis != nullptr);
+        assert(!afterThis->isBranch());
+        assert(afterThis->getFragment() != nullptr);
+
+        frags.insert(afterThis->getFragment());
+    }
+
+    std::size_t numAnchorsFound = 0;
+
+    for (IRFragment *frag : frags) {
+        for (auto &rtl : *frag->getRTLs()) {
+            for (RTL::iterator ss = rtl->begin(); ss != rtl->end(); ++ss) {
+                const auto it = insertions.find(*ss);
+                if (it == insertions.end()) {
+                    continue;
+                }
+
+                const RTL::iterator next = std::next(ss);
+                for (const SharedStmt &stmt : it->second) {
+                    rtl->insert(next, stmt);
+                    stmt->setFragment(frag);
+                }
+
+                // do not visit the newly inserted statements
+                ss = std::prev(next);
+                numAnchorsFound++;
+            }
+        }
+    }
+
+    return numAnchorsFound == insertions.size();
+}
+
+
 std::shared_ptr<Assign> UserProc::replacePhiByAssign(const std::shared_ptr<const PhiAssign> &orig,
                                                      const SharedExp &rhs)
 {
@@ -1065,8 +1110,7 @@ void UserProc::printLocals(OStream &os) const
 void UserProc::debugPrintAll(const QString &stepName)
 {
     if (m_prog->getProject()->getSettings()->verboseOutput) {
-        numberStatements();
-
+        // Note: Statements are numbered by print()
         QDir outputDir   = m_prog->getProject()->getSettings()->getOutputDirectory();
         QString filePath = outputDir.absoluteFilePath(getName());
 
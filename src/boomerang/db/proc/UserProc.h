@@ -16,6 +16,8 @@
 #include "boomerang/db/proc/ProcCFG.h"
 #include "boomerang/util/StatementList.h"
 
+#include <unordered_map>
+
 
 class Binary;
 class UserProc;
@@ -68,6 +70,9 @@ public:
      */
     typedef std::multimap<SharedConstExp, SharedExp, lessExpStar> SymbolMap;
 
+    /// A map from anchor statements to the statements that are to be inserted after them.
+    typedef std::unordered_map<SharedStmt, std::vector<SharedStmt>> StmtInsertionMap;
+
 public:
     /**
      * \param address Address of entry point of function
@@ -145,9 +150,22 @@ public:
 public:
     // statement related
 
-    /// Update statement numbers
+    /**
+     * Update statement numbers. Statements are numbered consecutively, starting at 1,
+     * in the order of the fragments of the CFG.
+     * Statements added to this proc afterwards are numbered when they are added
+     * (see \ref allocateStmtNumber), so this only needs to be called again
+     * to number the statements in CFG order.
+     */
     void numberStatements() const;
 
+    /// \returns a new statement number that is not used by any other statement of this proc.
+    int allocateStmtNumber() const { return ++m_lastStmtNumber; }
+
+    /// \returns a new statement ID that is unique among the statements of this proc.
+    /// \sa Statement::getID
+    uint32 allocateStmtID() { return m_nextStmtID++; }
+
     /// \returns all statements in this UserProc
     void getStatements(StatementList &stmts) const;
 
@@ -161,6 +179,13 @@ public:
     /// \returns true if successfully inserted.
     bool insertStatementAfter(const SharedStmt &afterThis, const SharedStmt &stmt);
 
+    /// Insert statements after their anchor statements.
+    /// The statements for each anchor are inserted directly after the anchor,
+    /// in the order they are given. Unlike insertStatementAfter, this only does
+    /// a single pass over the RTLs of every fragment that contains an anchor.
+    /// \returns true if all anchors were found.
+    bool insertStatementsAfter(const StmtInsertionMap &insertions);
+
     /// Searches for the phi assignment \p orig and if found, replaces the RHS with \p newRhs
     /// (converting it to an ordiary assign). If successful, the new Assign is returned,
     /// otherwise nullptr.
@@ -455,6 +480,9 @@ private:
 
     std::shared_ptr<ProcSet> m_recursionGroup;
 
+    uint32 m_nextStmtID          = 0; ///< ID of the next statement added to this proc
+    mutable int m_lastStmtNumber = 0; ///< Highest statement number used by this proc
+
     /**
      * We ensure that there is only one return statement now.
      * See code in frontend/frontend.cpp handling case StmtType::Ret.
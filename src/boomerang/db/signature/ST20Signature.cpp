@@ -65,7 +65,7 @@ SharedExp ST20Signature::getArgumentExp(int n) const
     // m[%sp+4], etc.
     SharedExp sp = Location::regOf(REG_ST20_SP);
 
-    if ((m_params.size() != 0) && (*m_params[0]->getExp() == *sp)) {
+    if ((m_params.size() != 0) && m_params[0]->getExp()->isRegN(REG_ST20_SP)) {
         n--;
     }
 
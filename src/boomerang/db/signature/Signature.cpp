@@ -17,6 +17,7 @@
 #include "boomerang/db/signature/Signature.h"
 #include "boomerang/db/signature/Win32Signature.h"
 #include "boomerang/db/signature/X86Signature.h"
+#include "boomerang/ssl/exp/Const.h"
 #include "boomerang/ssl/exp/Location.h"
 #include "boomerang/ssl/exp/RefExp.h"
 #include "boomerang/ssl/exp/Terminal.h"
@@ -547,16 +548,27 @@ bool Signature::isAddrOfStackLocal(RegNum spIndex, const SharedConstExp &e) cons
     }
 
     // e must be sp -/+ K or just sp
-    SharedConstExp sp = Location::regOf(spIndex);
-
     const OPER op = e->getOper();
     if ((op != opMinus) && (op != opPlus)) {
         // Matches if e is sp or sp{0} or sp{-}
-        return *e == *sp || (e->isSubscript() && e->access<RefExp>()->isImplicitDef() &&
-                             *e->getSubExp1() == *sp);
+        return isStackPointer(spIndex, e);
+    }
+
+    // Fast path for the common case sp -/+ K, which does not need to be simplified.
+    // Note that sp + -K is sp - K, and sp + 0 is just sp (not an address of a local).
+    if (e->getSubExp2()->isIntConst() && isStackPointer(spIndex, e->getSubExp1())) {
+        const int k = e->access<Const, 2>()->getInt();
+        if (k == 0) {
+            return false;
+        }
+        else if (k > 0) {
+            return isOpCompatStackLocal(op);
+        }
+
+        return isOpCompatStackLocal(op == opPlus ? opMinus : opPlus);
     }
 
-    // We may have weird expressions like sp + -4
+    // We may have weird expressions like (sp - 8) + 4
     // which is the address of a stack local on x86
     SharedConstExp exp2 = e->clone()->simplify();
     if (!isOpCompatStackLocal(exp2->getOper())) {
@@ -572,15 +584,17 @@ bool Signature::isAddrOfStackLocal(RegNum spIndex, const SharedConstExp &e) cons
     }
 
     // first operand must be sp or sp{0} or sp{-}
-    if (sub1->isSubscript()) {
-        if (!sub1->access<RefExp>()->isImplicitDef()) {
-            return false;
-        }
+    return isStackPointer(spIndex, sub1);
+}
 
-        sub1 = sub1->getSubExp1();
+
+bool Signature::isStackPointer(RegNum spIndex, const SharedConstExp &e)
+{
+    if (e->isSubscript()) {
+        return e->access<RefExp>()->isImplicitDef() && e->getSubExp1()->isRegN(spIndex);
     }
 
-    return *sub1 == *sp;
+    return e->isRegN(spIndex);
 }
 
 
@@ -212,6 +212,10 @@ public:
 public:
     void print(OStream &out, bool = false) const;
 
+private:
+    /// \returns true if \p e is sp, sp{0} or sp{-}
+    static bool isStackPointer(RegNum spIndex, const SharedConstExp &e);
+
 protected:
     QString m_name;    ///< name of procedure
     QString m_sigFile; ///< signature file this signature was read from (for libprocs)
@@ -152,7 +152,7 @@ SharedExp Win32Signature::getArgumentExp(int n) const
 
     SharedExp esp = Location::regOf(REG_X86_ESP);
 
-    if ((m_params.size() != 0) && (*m_params[0]->getExp() == *esp)) {
+    if ((m_params.size() != 0) && m_params[0]->getExp()->isRegN(REG_X86_ESP)) {
         n--;
     }
 
@@ -169,7 +169,7 @@ SharedExp Win32TcSignature::getArgumentExp(int n) const
 
     SharedExp esp = Location::regOf(REG_X86_ESP);
 
-    if (!m_params.empty() && (*m_params[0]->getExp() == *esp)) {
+    if (!m_params.empty() && m_params[0]->getExp()->isRegN(REG_X86_ESP)) {
         n--;
     }
 
@@ -196,7 +196,7 @@ SharedExp Win32Signature::getProven(SharedExp left) const
 {
     int nparams = m_params.size();
 
-    if ((nparams > 0) && (*m_params[0]->getExp() == *Location::regOf(REG_X86_ESP))) {
+    if ((nparams > 0) && m_params[0]->getExp()->isRegN(REG_X86_ESP)) {
         nparams--;
     }
 
@@ -267,7 +267,7 @@ SharedExp Win32TcSignature::getProven(SharedExp left) const
         if (left->access<Const, 1>()->getInt() == REG_X86_ESP) {
             int nparams = m_params.size();
 
-            if ((nparams > 0) && (*m_params[0]->getExp() == *Location::regOf(REG_X86_ESP))) {
+            if ((nparams > 0) && m_params[0]->getExp()->isRegN(REG_X86_ESP)) {
                 nparams--;
             }
 
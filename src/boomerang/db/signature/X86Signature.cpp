@@ -148,7 +148,7 @@ SharedExp X86Signature::getArgumentExp(int n) const
 
     SharedExp esp = Location::regOf(REG_X86_ESP);
 
-    if ((m_params.size() != 0) && (*m_params[0]->getExp() == *esp)) {
+    if ((m_params.size() != 0) && m_params[0]->getExp()->isRegN(REG_X86_ESP)) {
         n--;
     }
 
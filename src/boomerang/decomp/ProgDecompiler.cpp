@@ -70,19 +70,7 @@ void ProgDecompiler::decompile()
     globalTypeAnalysis();
 
     if (m_prog->getProject()->getSettings()->removeReturns) {
-        // Repeat until no change. Not 100% sure if needed.
-        while (removeUnusedParamsAndReturns()) {
-            for (auto &module : m_prog->getModuleList()) {
-                for (Function *proc : *module) {
-                    if (proc->isLib()) {
-                        continue;
-                    }
-
-                    PassManager::get()->executePass(PassID::BranchAnalysis,
-                                                    static_cast<UserProc *>(proc));
-                }
-            }
-        }
+        removeUnusedParamsAndReturns();
     }
 
     globalTypeAnalysis();
@@ -201,7 +189,25 @@ void ProgDecompiler::removeUnusedGlobals()
 bool ProgDecompiler::removeUnusedParamsAndReturns()
 {
     LOG_MSG("Removing unused returns...");
-    return UnusedReturnRemover(m_prog).removeUnusedReturns();
+
+    UnusedReturnRemover remover(m_prog);
+    bool change          = remover.removeUnusedReturns();
+    const bool anyChange = change;
+
+    // Repeat until no change. Not 100% sure if needed.
+    // Only the procs changed by the last round (and their neighbours in the call graph)
+    // can be affected by another round.
+    while (change) {
+        const ProcSet changedProcs = remover.getChangedProcs();
+
+        for (UserProc *proc : changedProcs) {
+            PassManager::get()->executePass(PassID::BranchAnalysis, proc);
+        }
+
+        change = remover.removeUnusedReturns(changedProcs);
+    }
+
+    return anyChange;
 }
 
 
@@ -216,7 +222,6 @@ void ProgDecompiler::fromSSAForm()
             }
 
             UserProc *proc = static_cast<UserProc *>(pp);
-            proc->numberStatements();
             PassManager::get()->executePass(PassID::FromSSAForm, proc);
         }
     }
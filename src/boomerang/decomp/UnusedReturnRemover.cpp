@@ -23,17 +23,6 @@
 #include "boomerang/visitor/expmodifier/ImplicitConverter.h"
 
 
-bool compareUserProc(const UserProc *lhs, const UserProc *rhs)
-{
-    if (lhs && rhs) {
-        return lhs->getEntryAddress() < rhs->getEntryAddress();
-    }
-    else {
-        return lhs < rhs;
-    }
-}
-
-
 UnusedReturnRemover::UnusedReturnRemover(Prog *prog)
     : m_prog(prog)
 {
@@ -44,20 +33,53 @@ bool UnusedReturnRemover::removeUnusedReturns()
 {
     for (const auto &module : m_prog->getModuleList()) {
         for (Function *proc : *module) {
-            if (proc && !proc->isLib() && static_cast<UserProc *>(proc)->isDecoded()) {
-                m_removeRetSet.insert(static_cast<UserProc *>(proc));
-            }
-            // else e.g. use -sf file to just prototype the proc
+            scheduleProc(proc);
         }
     }
 
+    return processWorkSet();
+}
+
+
+bool UnusedReturnRemover::removeUnusedReturns(const ProcSet &procs)
+{
+    for (UserProc *proc : procs) {
+        scheduleProc(proc);
+
+        for (Function *callee : proc->getCallees()) {
+            scheduleProc(callee);
+        }
+
+        for (const std::shared_ptr<CallStatement> &caller : proc->getCallers()) {
+            scheduleProc(caller->getProc());
+        }
+    }
+
+    return processWorkSet();
+}
+
+
+void UnusedReturnRemover::scheduleProc(Function *func)
+{
+    if (func && !func->isLib() && static_cast<UserProc *>(func)->isDecoded()) {
+        m_removeRetSet.insert(static_cast<UserProc *>(func));
+    }
+    // else e.g. use -sf file to just prototype the proc
+}
+
+
+bool UnusedReturnRemover::processWorkSet()
+{
+    m_changedProcs.clear();
+
     bool change = false;
-    // The workset is processed in order of entry address. This is to provide a consistent
-    // deterministic order of processing. Note that sometimes changes propagate down the call tree
-    // (no caller uses potential returns for child), and sometimes up the call tree
-    // (removal of returns and/or dead code removes parameters, which affects all callers).
+    // The workset is processed in order of entry address (which is the ordering of ProcSet).
+    // This is to provide a consistent deterministic order of processing. Note that sometimes
+    // changes propagate down the call tree (no caller uses potential returns for child), and
+    // sometimes up the call tree (removal of returns and/or dead code removes parameters, which
+    // affects all callers).
     while (!m_removeRetSet.empty()) {
-        auto it = std::min_element(m_removeRetSet.begin(), m_removeRetSet.end(), compareUserProc);
+        auto it = m_removeRetSet.begin();
         assert(*it != nullptr);
         const bool removedReturns = removeUnusedParamsAndReturns(*it);
 
@@ -68,6 +90,7 @@ bool UnusedReturnRemover::removeUnusedReturns()
 
             // type analysis might propagate statements that could not be propagated before
             PassManager::get()->executePass(PassID::UnusedStatementRemoval, *it);
+            m_changedProcs.insert(*it);
         }
         change |= removedReturns;
 
@@ -204,6 +227,8 @@ void UnusedReturnRemover::updateForUseChange(UserProc *proc)
         LOG_MSG("%%% updating dataflow:");
     }
 
+    m_changedProcs.insert(proc);
+
     // Save the old parameters and call liveness
     const size_t oldNumParameters = proc->getParameters().size();
     std::map<std::shared_ptr<CallStatement>, UseCollector> callLiveness;
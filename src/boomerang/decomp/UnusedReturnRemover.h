@@ -40,6 +40,25 @@ public:
      */
     bool removeUnusedReturns();
 
+    /**
+     * Same as \ref removeUnusedReturns, but only considers \p procs and their direct callers
+     * and callees (and everything affected by changes to those).
+     * Used to revisit the procs changed by a previous run without sweeping the whole program.
+     * \returns true if any change
+     */
+    bool removeUnusedReturns(const ProcSet &procs);
+
+    /// \returns all procs whose parameters, returns or dataflow were changed
+    /// by the last call to \ref removeUnusedReturns.
+    const ProcSet &getChangedProcs() const { return m_changedProcs; }
+
+private:
+    /// Processes all procs in m_removeRetSet, in order of entry address
+    bool processWorkSet();
+
+    /// Schedules \p func for return removal if it is a decoded user proc.
+    void scheduleProc(Function *func);
+
 private:
     /**
      * Remove any returns that are not used by any callers
@@ -87,4 +106,5 @@ private:
 private:
     Prog *m_prog;
     ProcSet m_removeRetSet; ///< UserProcs that need their returns updated
+    ProcSet m_changedProcs; ///< UserProcs that were changed while processing m_removeRetSet
 };
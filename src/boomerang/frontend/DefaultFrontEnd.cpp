@@ -54,8 +54,9 @@ DefaultFrontEnd::~DefaultFrontEnd()
 
 bool DefaultFrontEnd::initialize(Project *project)
 {
-    m_program    = project->getProg();
-    m_binaryFile = project->getLoadedBinaryFile();
+    m_program           = project->getProg();
+    m_binaryFile        = project->getLoadedBinaryFile();
+    m_importsClassified = false;
 
     if (!m_decoder) {
         return false;
@@ -224,7 +225,7 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
     MachineInstruction insn;
 
     while ((addr = m_targetQueue.popAddress(*cfg)) != Address::INVALID) {
-        std::list<MachineInstruction> bbInsns;
+        std::vector<MachineInstruction> bbInsns;
 
         // Indicates whether or not the next instruction to be decoded is the lexical successor of
         // the current one. Will be true for all NCTs and for CTIs with a fall through branch.
@@ -246,7 +247,30 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
                 }
             }
 
-            if (!disassembleInstruction(addr, insn)) {
+            // Disassemble up to the next CTI, but do not run into the next basic block.
+            const Address limit          = cfg->getNextBBStartAfter(addr);
+            const std::size_t numDecoded = bbInsns.size();
+            const bool blockOk           = disassembleBlock(addr, limit, bbInsns);
+
+            for (std::size_t i = numDecoded; i < bbInsns.size(); ++i) {
+                const MachineInstruction &decoded = bbInsns[i];
+
+                if (m_program->getProject()->getSettings()->traceDecoder) {
+                    LOG_MSG("*%1 %2 %3", decoded.m_addr, decoded.m_mnem.data(),
+                            decoded.m_opstr.data());
+                }
+
+                // alert the watchers that we have decoded an instruction
+                numBytesDecoded += decoded.m_size;
+                m_program->getProject()->alertInstructionDecoded(decoded.m_addr, decoded.m_size);
+
+                if (!decoded.isCTI()) {
+                    addr += decoded.m_size;
+                    lastAddr = std::max(lastAddr, addr);
+                }
+            }
+
+            if (!blockOk || bbInsns.size() == numDecoded) {
                 // We might have disassembled a valid instruction, but the disassembler
                 // does not recognize it. Do not throw away previous instructions;
                 // instead, create a new BB from them
@@ -259,28 +283,15 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
                 break; // try next instruction in queue
             }
 
-            if (m_program->getProject()->getSettings()->traceDecoder) {
-                LOG_MSG("*%1 %2 %3", addr, insn.m_mnem.data(), insn.m_opstr.data());
-            }
-
-            // alert the watchers that we have decoded an instruction
-            numBytesDecoded += insn.m_size;
-            m_program->getProject()->alertInstructionDecoded(addr, insn.m_size);
-
-            // classify the current instruction. If it is not a CTI,
-            // continue disassembling sequentially
-            const bool isCTI = insn.isInGroup(MIGroup::Call) || insn.isInGroup(MIGroup::Jump) ||
-                               insn.isInGroup(MIGroup::Ret);
-
-            if (!isCTI) {
-                addr += insn.m_size;
-                bbInsns.push_back(insn);
-
-                lastAddr = std::max(lastAddr, addr);
+            // If the block does not end with a CTI, we either reached the start of another
+            // basic block or the end of the section. Continue disassembling sequentially.
+            if (!bbInsns.back().isCTI()) {
                 continue;
             }
 
             // this is a CTI. Lift the instruction to gain access to call/jump semantics
+            insn = bbInsns.back();
+
             LiftedInstruction lifted;
             if (!liftInstruction(insn, lifted)) {
                 LOG_ERROR("Cannot lift instruction '%1 %2 %3'", insn.m_addr, insn.m_mnem.data(),
@@ -291,7 +302,6 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
                 break;
             }
 
-            bbInsns.push_back(insn);
             const RTL::StmtList &sl = lifted.getFirstRTL()->getStatements();
 
             for (auto ss = sl.begin(); ss != sl.end(); ++ss) {
@@ -410,10 +420,7 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
                 if (refersToImportedFunction(call->getDest())) {
                     // Dynamic linked proc pointers are treated as static.
                     const Address linkedAddr = call->getDest()->access<Const, 1>()->getAddr();
-                    const QString name       = m_program->getBinaryFile()
-                                             ->getSymbols()
-                                             ->findSymbolByAddress(linkedAddr)
-                                             ->getName();
+                    const QString name       = findImportedFunction(linkedAddr)->getName();
 
                     Function *function = proc->getProg()->getOrCreateLibraryProc(name);
                     call->setDestProc(function);
@@ -427,10 +434,7 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
                 const Address functionAddr = getAddrOfLibraryThunk(call, proc);
                 if (functionAddr != Address::INVALID) {
                     // Yes, it's a library function. Look up its name.
-                    QString name = m_program->getBinaryFile()
-                                       ->getSymbols()
-                                       ->findSymbolByAddress(functionAddr)
-                                       ->getName();
+                    QString name = findImportedFunction(functionAddr)->getName();
 
                     // Assign the proc to the call
                     Function *p = m_program->getOrCreateLibraryProc(name);
@@ -491,10 +495,7 @@ bool DefaultFrontEnd::disassembleProc(UserProc *proc, Address addr)
 
                     if (procName.isEmpty() && refersToImportedFunction(call->getDest())) {
                         Address a = call->getDest()->access<Const, 1>()->getAddr();
-                        procName  = m_program->getBinaryFile()
-                                       ->getSymbols()
-                                       ->findSymbolByAddress(a)
-                                       ->getName();
+                        procName  = findImportedFunction(a)->getName();
                     }
 
                     if (!procName.isEmpty() && isNoReturnCallDest(procName)) {
@@ -620,10 +621,17 @@ bool DefaultFrontEnd::liftProcImpl(UserProc *proc)
 
     procCFG->setEntryAndExitFragment(procCFG->getFragmentByAddr(proc->getEntryAddress()));
 
+    processLiftedStatements(proc);
+    return true;
+}
+
+
+void DefaultFrontEnd::processLiftedStatements(UserProc *proc)
+{
     IRFragment::RTLIterator rit;
     StatementList::iterator sit;
 
-    for (IRFragment *frag : *procCFG) {
+    for (IRFragment *frag : *proc->getCFG()) {
         for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt != nullptr;
              stmt            = frag->getNextStmt(rit, sit)) {
             assert(stmt->getProc() == nullptr || stmt->getProc() == proc);
@@ -631,8 +639,6 @@ bool DefaultFrontEnd::liftProcImpl(UserProc *proc)
             stmt->setFragment(frag);
         }
     }
-
-    return true;
 }
 
 
@@ -760,6 +766,35 @@ bool DefaultFrontEnd::disassembleInstruction(Address pc, MachineInstruction &ins
 }
 
 
+bool DefaultFrontEnd::disassembleBlock(Address pc, Address limit,
+                                       std::vector<MachineInstruction> &insns)
+{
+    BinaryImage *image = m_program->getBinaryFile()->getImage();
+    if (!image || (image->getSectionByAddr(pc) == nullptr)) {
+        LOG_ERROR("Attempted to disassemble outside any known section at address %1", pc);
+        return false;
+    }
+
+    const BinarySection *section = image->getSectionByAddr(pc);
+    if (section->getHostAddr() == HostAddress::INVALID) {
+        LOG_ERROR("Attempted to disassemble instruction in unmapped section '%1' at address %2",
+                  section->getName(), pc);
+        return false;
+    }
+
+    const ptrdiff_t hostNativeDiff = (section->getHostAddr() - section->getSourceAddr()).value();
+    limit = std::min(limit, section->getSourceAddr() + section->getSize());
+
+    try {
+        return m_decoder->disassembleBlock(pc, limit, hostNativeDiff, insns);
+    }
+    catch (std::runtime_error &e) {
+        LOG_ERROR("%1", e.what());
+        return false;
+    }
+}
+
+
 bool DefaultFrontEnd::liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted)
 {
     const bool ok = m_decoder->liftInstruction(insn, lifted);
@@ -883,9 +918,8 @@ bool DefaultFrontEnd::liftBB(BasicBlock *currentBB, UserProc *proc,
 
                 // jump to a library function
                 // replace with a call/ret
-                const BinarySymbol
-                    *sym = m_program->getBinaryFile()->getSymbols()->findSymbolByAddress(
-                        jumpDest->access<Const, 1>()->getAddr());
+                const BinarySymbol *sym = findImportedFunction(
+                    jumpDest->access<Const, 1>()->getAddr());
                 assert(sym != nullptr);
 
                 QString func = sym->getName();
@@ -946,10 +980,7 @@ bool DefaultFrontEnd::liftBB(BasicBlock *currentBB, UserProc *proc,
             if (refersToImportedFunction(call->getDest())) {
                 // Dynamic linked proc pointers are treated as static.
                 Address linkedAddr = call->getDest()->access<Const, 1>()->getAddr();
-                QString name       = m_program->getBinaryFile()
-                                   ->getSymbols()
-                                   ->findSymbolByAddress(linkedAddr)
-                                   ->getName();
+                QString name       = findImportedFunction(linkedAddr)->getName();
 
                 Function *function = proc->getProg()->getOrCreateLibraryProc(name);
                 call->setDestProc(function);
@@ -959,10 +990,7 @@ bool DefaultFrontEnd::liftBB(BasicBlock *currentBB, UserProc *proc,
             const Address functionAddr = getAddrOfLibraryThunk(call, proc);
             if (functionAddr != Address::INVALID) {
                 // Yes, it's a library function. Look up its name.
-                QString name = m_program->getBinaryFile()
-                                   ->getSymbols()
-                                   ->findSymbolByAddress(functionAddr)
-                                   ->getName();
+                QString name = findImportedFunction(functionAddr)->getName();
 
                 // Assign the proc to the call
                 Function *p = proc->getProg()->getOrCreateLibraryProc(name);
@@ -1036,10 +1064,7 @@ bool DefaultFrontEnd::liftBB(BasicBlock *currentBB, UserProc *proc,
 
                 if (procName.isEmpty() && refersToImportedFunction(call->getDest())) {
                     Address a = call->getDest()->access<Const, 1>()->getAddr();
-                    procName  = m_program->getBinaryFile()
-                                   ->getSymbols()
-                                   ->findSymbolByAddress(a)
-                                   ->getName();
+                    procName  = findImportedFunction(a)->getName();
                 }
 
                 IRFragment *callFrag = procCFG->createFragment(FragType::Call, std::move(bbRTLs),
@@ -1171,16 +1196,36 @@ bool DefaultFrontEnd::isHelperFunc(Address, Address, RTLList &)
 
 bool DefaultFrontEnd::refersToImportedFunction(const SharedExp &exp)
 {
-    if (exp && exp->isMemOf() && exp->access<Exp, 1>()->isIntConst()) {
-        const BinarySymbol *symbol = m_program->getBinaryFile()->getSymbols()->findSymbolByAddress(
-            exp->access<Const, 1>()->getAddr());
+    return exp && exp->isMemOf() && exp->access<Exp, 1>()->isIntConst() &&
+           findImportedFunction(exp->access<Const, 1>()->getAddr()) != nullptr;
+}
 
-        if (symbol && symbol->isImportedFunction()) {
-            return true;
+
+const BinarySymbol *DefaultFrontEnd::findImportedFunction(Address addr)
+{
+    if (!m_importsClassified) {
+        classifyImports();
+    }
+
+    auto it = m_importedFunctions.find(addr.value());
+    return (it != m_importedFunctions.end()) ? it->second : nullptr;
+}
+
+
+void DefaultFrontEnd::classifyImports()
+{
+    m_importedFunctions.clear();
+    m_libraryThunks.clear();
+
+    // The loaders mark IAT slots, PLT entries and other import stubs as imported functions.
+    // Index all addresses of a symbol (not just its location) to match findSymbolByAddress.
+    for (const auto &[addr, symbol] : m_program->getBinaryFile()->getSymbols()->getAddrIndex()) {
+        if (symbol->isImportedFunction()) {
+            m_importedFunctions[addr.value()] = symbol.get();
         }
     }
 
-    return false;
+    m_importsClassified = true;
 }
 
 
@@ -1215,13 +1260,8 @@ void DefaultFrontEnd::preprocessProcGoto(RTL::StmtList::iterator ss, Address des
 
     Function *proc = m_program->getFunctionByAddr(dest);
 
-    if (proc == nullptr) {
-        const BinarySymbolTable *symbols = m_program->getBinaryFile()->getSymbols();
-        const BinarySymbol *symbol       = symbols->findSymbolByAddress(dest);
-
-        if (symbol && symbol->isImportedFunction()) {
-            proc = m_program->getOrCreateFunction(dest);
-        }
+    if (proc == nullptr && findImportedFunction(dest) != nullptr) {
+        proc = m_program->getOrCreateFunction(dest);
     }
 
     if (proc != nullptr && proc != reinterpret_cast<Function *>(-1)) {
@@ -1277,7 +1317,20 @@ Address DefaultFrontEnd::getAddrOfLibraryThunk(const std::shared_ptr<CallStateme
         return Address::INVALID;
     }
 
-    Address callAddr         = call->getFixedDest();
+    const Address callAddr = call->getFixedDest();
+    auto it                = m_libraryThunks.find(callAddr.value());
+    if (it != m_libraryThunks.end()) {
+        return it->second;
+    }
+
+    const Address thunkDest           = findLibraryThunkDest(callAddr, proc);
+    m_libraryThunks[callAddr.value()] = thunkDest;
+    return thunkDest;
+}
+
+
+Address DefaultFrontEnd::findLibraryThunkDest(Address callAddr, UserProc *proc)
+{
     const BinaryImage *image = m_program->getBinaryFile()->getImage();
     if (!Util::inRange(callAddr, image->getLimitTextLow(), image->getLimitTextHigh())) {
         return Address::INVALID;
@@ -15,6 +15,8 @@
 #include "boomerang/ssl/RTL.h"
 
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 
 class Function;
@@ -28,6 +30,7 @@ class Signature;
 class Statement;
 class CallStatement;
 class BinaryFile;
+class BinarySymbol;
 class MachineInstruction;
 class IRFragment;
 
@@ -121,6 +124,11 @@ protected:
     /// \returns true on success
     bool disassembleInstruction(Address pc, MachineInstruction &insn);
 
+    /// Disassemble straight-line code starting at \p pc up to and including the next CTI,
+    /// stopping before \p limit or the end of the section. Instructions are appended to \p insns.
+    /// \returns true on success
+    bool disassembleBlock(Address pc, Address limit, std::vector<MachineInstruction> &insns);
+
     /// Lifts a single instruction \p insn to an RTL.
     /// \returns true on success
     bool liftInstruction(const MachineInstruction &insn, LiftedInstruction &lifted);
@@ -128,6 +136,12 @@ protected:
     /// Does the actual lifting for \ref DefaultFrontEnd::liftProc
     virtual bool liftProcImpl(UserProc *proc);
 
+    /// Post-processes the statements of \p proc after all fragments have been lifted
+    /// and connected. The default implementation sets the proc and fragment of all statements.
+    /// Derived classes that need to fix up lifted statements should do this
+    /// during the same traversal instead of walking all statements again.
+    virtual void processLiftedStatements(UserProc *proc);
+
 private:
     bool liftBB(BasicBlock *bb, UserProc *proc,
                 std::list<std::shared_ptr<CallStatement>> &callList);
@@ -135,6 +149,13 @@ private:
     /// \returns true iff \p exp is a memof that references the address of an imported function.
     bool refersToImportedFunction(const SharedExp &exp);
 
+    /// \returns the imported function symbol at address \p addr (e.g. an IAT slot
+    /// or a PLT entry), or nullptr if there is no imported function at \p addr.
+    const BinarySymbol *findImportedFunction(Address addr);
+
+    /// Builds the index of imported functions from the symbols marked by the loader.
+    void classifyImports();
+
     /**
      * Add a synthetic return instruction and basic block (or a branch to the existing return
      * instruction).
@@ -163,6 +184,10 @@ private:
      */
     Address getAddrOfLibraryThunk(const std::shared_ptr<CallStatement> &call, UserProc *proc);
 
+    /// Decodes the instruction at \p callAddr to check if it is a library thunk.
+    /// \sa getAddrOfLibraryThunk
+    Address findLibraryThunkDest(Address callAddr, UserProc *proc);
+
 protected:
     /// After disassembly, tag all the BBs that are part of \p proc
     void tagFunctionBBs(UserProc *proc);
@@ -182,4 +207,12 @@ protected:
 
     /// Stores the list of fragments needing successors during lifting
     std::list<IRFragment *> m_needSuccessors;
+
+private:
+    /// Imported functions (IAT slots, PLT entries etc.), indexed by address
+    std::unordered_map<Address::value_type, const BinarySymbol *> m_importedFunctions;
+
+    /// Cached results of \ref getAddrOfLibraryThunk, indexed by call destination
+    std::unordered_map<Address::value_type, Address> m_libraryThunks;
+    bool m_importsClassified = false;
 };
@@ -25,3 +25,9 @@ bool MachineInstruction::isInGroup(MIGroup groupID) const
 {
     return (m_groups & (1 << (int)groupID)) != 0;
 }
+
+
+bool MachineInstruction::isCTI() const
+{
+    return isInGroup(MIGroup::Call) || isInGroup(MIGroup::Jump) || isInGroup(MIGroup::Ret);
+}
@@ -54,6 +54,9 @@ public:
     void setGroup(MIGroup groupID, bool enabled);
     bool isInGroup(MIGroup groupID) const;
 
+    /// \returns true if this is a control transfer instruction (call, jump or return).
+    bool isCTI() const;
+
     std::size_t getNumOperands() const { return m_operands.size(); }
 };
 
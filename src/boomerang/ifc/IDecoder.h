@@ -14,6 +14,8 @@
 #include "boomerang/frontend/MachineInstruction.h"
 #include "boomerang/ssl/Register.h"
 
+#include <vector>
+
 
 class Exp;
 class RTL;
@@ -49,6 +51,43 @@ public:
     [[nodiscard]] virtual bool disassembleInstruction(Address pc, ptrdiff_t delta,
                                                       MachineInstruction &result) = 0;
 
+    /**
+     * Disassembles straight-line code starting at \p pc, up to and including the first
+     * control transfer instruction, or until the next instruction would start at or after
+     * \p limit. The disassembled instructions are appended to \p result.
+     * If an instruction cannot be disassembled, all instructions before it are kept in
+     * \p result, and false is returned.
+     *
+     * The default implementation disassembles the block instruction by instruction.
+     * Decoders that can keep decoder state between instructions should override this.
+     *
+     * \param pc Address of the first instruction of the block
+     * \param limit Address where disassembling stops (e.g. the start of the next basic block)
+     * \param delta Host - native address difference
+     *
+     * \returns true iff all instructions of the block were disassembled successfully.
+     */
+    [[nodiscard]] virtual bool disassembleBlock(Address pc, Address limit, ptrdiff_t delta,
+                                                std::vector<MachineInstruction> &result)
+    {
+        while (pc < limit) {
+            MachineInstruction &insn = result.emplace_back();
+
+            if (!disassembleInstruction(pc, delta, insn)) {
+                result.pop_back();
+                return false;
+            }
+
+            if (insn.isCTI()) {
+                break;
+            }
+
+            pc += insn.m_size;
+        }
+
+        return true;
+    }
+
     /// Lift a disassembled instruction to an RTL
     /// \returns true if lifting the instruction was succesful.
     [[nodiscard]] virtual bool liftInstruction(const MachineInstruction &insn,
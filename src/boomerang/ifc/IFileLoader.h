@@ -76,13 +76,6 @@ public:
     virtual Address getEntryPoint() = 0;
 
 public:
-    /// Relocation functions
-    virtual bool isRelocationAt(Address addr)
-    {
-        Q_UNUSED(addr);
-        return false;
-    }
-
     /// \returns the target of the jmp/jXX instruction at address \p addr.
     /// If there is no jump at address \p addr, returns Address::INVALID.
     virtual Address getJumpTarget(Address addr) const
@@ -11,6 +11,7 @@
 
 #include "boomerang/core/Project.h"
 #include "boomerang/core/Settings.h"
+#include "boomerang/db/DefCollector.h"
 #include "boomerang/db/Prog.h"
 #include "boomerang/db/proc/UserProc.h"
 #include "boomerang/ssl/exp/Const.h"
@@ -18,23 +19,18 @@
 #include "boomerang/ssl/statements/CallStatement.h"
 #include "boomerang/ssl/statements/PhiAssign.h"
 #include "boomerang/ssl/statements/ReturnStatement.h"
-#include "boomerang/util/log/Log.h"
 #include "boomerang/visitor/expmodifier/ExpSubscripter.h"
 #include "boomerang/visitor/stmtmodifier/StmtSubscripter.h"
 
 
 static const SharedExp defineAll = Terminal::get(opDefineAll); // An expression representing <all>
 
-// There is an entry in stacks[defineAll] that represents the latest definition
+// There is a stack for defineAll that represents the latest definition
 // from a define-all source. It is needed for variables that don't have a definition as yet
-// (i.e. stacks[x].empty() is true). As soon as a real definition to x appears,
-// stacks[defineAll] does not apply for variable x. This is needed to get correct
+// (i.e. their stack is empty). As soon as a real definition to x appears,
+// the defineAll stack does not apply for variable x. This is needed to get correct
 // operation of the use collectors in calls.
 
-// Care with the Stacks object (a map from expression to stack);
-// using Stacks[q].empty() can needlessly insert an empty stack
-#define STACKS_EMPTY(q) (stacks.find(q) == stacks.end() || stacks[q].empty())
-
 
 BlockVarRenamePass::BlockVarRenamePass()
     : IPass("BlockVarRename", PassID::BlockVarRename)
@@ -44,7 +40,6 @@ BlockVarRenamePass::BlockVarRenamePass()
 
 bool BlockVarRenamePass::execute(UserProc *proc)
 {
-    /// The stack which remembers the last definition of an expression.
     IRFragment *entryFrag = proc->getCFG()->getEntryFragment();
     if (entryFrag == nullptr) {
         return false;
@@ -54,25 +49,75 @@ bool BlockVarRenamePass::execute(UserProc *proc)
     const bool changed       = renameBlockVars(proc, entryIdx);
 
 #ifndef NDEBUG
-    for (auto &[var, stack] : stacks) {
-        Q_UNUSED(var);
+    assert(m_undoLog.empty());
+    for (const std::vector<SharedStmt> &stack : m_defStacks) {
         assert(stack.empty());
     }
 #endif
 
-    stacks.clear();
+    m_varIDs.clear();
+    m_defStacks.clear();
+    m_undoLog.clear();
     return changed;
 }
 
 
-bool BlockVarRenamePass::renameBlockVars(UserProc *proc, std::size_t n)
+bool BlockVarRenamePass::renameBlockVars(UserProc *proc, FragIndex entryIdx)
 {
-    if (proc->getCFG()->getNumFragments() == 0) {
+    const std::size_t numFrags = proc->getCFG()->getNumFragments();
+    if (numFrags == 0) {
         return false;
     }
 
-    bool changed                   = false;
     const bool assumeABICompliance = proc->getProg()->getProject()->getSettings()->assumeABI;
+    const DataFlow *df             = proc->getDataFlow();
+
+    // Children of each fragment in the dominator tree
+    std::vector<std::vector<FragIndex>> domChildren(numFrags);
+    for (FragIndex X = 0; X < numFrags; ++X) {
+        const FragIndex idom = df->getIdom(X);
+        if (idom < numFrags && idom != X) {
+            domChildren[idom].push_back(X);
+        }
+    }
+
+    struct DomTreeNode
+    {
+        FragIndex frag;
+        std::size_t nextChild;
+        std::size_t undoLogSize; ///< size of the undo log before entering this fragment
+    };
+
+    std::vector<DomTreeNode> nodes;
+    nodes.push_back({ entryIdx, 0, m_undoLog.size() });
+
+    // Note: Only changes to the statements of the entry fragment are reported
+    const bool changed = renameFragment(proc, entryIdx, assumeABICompliance);
+
+    while (!nodes.empty()) {
+        DomTreeNode &node = nodes.back();
+
+        if (node.nextChild < domChildren[node.frag].size()) {
+            // For each child X of n
+            const FragIndex X = domChildren[node.frag][node.nextChild++];
+
+            nodes.push_back({ X, 0, m_undoLog.size() });
+            renameFragment(proc, X, assumeABICompliance);
+        }
+        else {
+            // All children done; remove the definitions of this fragment from the stacks
+            popDefinitions(node.undoLogSize);
+            nodes.pop_back();
+        }
+    }
+
+    return changed;
+}
+
+
+bool BlockVarRenamePass::renameFragment(UserProc *proc, FragIndex n, bool assumeABICompliance)
+{
+    bool changed = false;
 
     // For each statement S in block n
     IRFragment::RTLIterator rit;
@@ -103,17 +148,11 @@ bool BlockVarRenamePass::renameBlockVars(UserProc *proc, std::size_t n)
         // MVE: Check for Call and Return Statements;
         // these have DefCollector objects that need to be updated
         // Do before the below, so CallStatements have not yet processed their defines
-        if (stmt->isCall() || stmt->isReturn()) {
-            DefCollector *col;
-
-            if (stmt->isCall()) {
-                col = stmt->as<CallStatement>()->getDefCollector();
-            }
-            else {
-                col = stmt->as<ReturnStatement>()->getCollector();
-            }
-
-            col->updateDefs(stacks, proc);
+        if (stmt->isCall()) {
+            updateDefs(stmt->as<CallStatement>()->getDefCollector(), proc);
+        }
+        else if (stmt->isReturn()) {
+            updateDefs(stmt->as<ReturnStatement>()->getCollector(), proc);
         }
 
         pushDefinitions(stmt, assumeABICompliance);
@@ -138,39 +177,11 @@ bool BlockVarRenamePass::renameBlockVars(UserProc *proc, std::size_t n)
                 continue;
             }
 
-            SharedStmt def = nullptr; // assume No reaching definition
-
-            if (!STACKS_EMPTY(a)) {
-                def = stacks[a].top();
-            }
-
             // "Replace jth operand with a_i"
-            pa->putAt(frag, def, a);
+            pa->putAt(frag, getLastDef(a), a);
         }
     }
 
-    // For each child X of n
-    // Note: linear search!
-    const std::size_t numFrags = proc->getCFG()->getNumFragments();
-
-    for (FragIndex X = 0; X < numFrags; ++X) {
-        const FragIndex idom = proc->getDataFlow()->getIdom(X);
-        if (idom == n && X != n) { // if 'n' is immediate dominator of X
-            renameBlockVars(proc, X);
-        }
-    }
-
-    // NOTE: Because of the need to pop childless calls from the Stacks, it is important in my
-    // algorithm to process the statments in the fragments *backwards*.
-    // (It is not important in Appel's algorithm, since he always pushes a definition
-    // for every variable defined on the Stacks).
-    IRFragment::RTLRIterator rrit;
-    StatementList::reverse_iterator srit;
-
-    for (SharedStmt S = frag->getLastStmt(rrit, srit); S; S = frag->getPrevStmt(rrit, srit)) {
-        popDefinitions(S, assumeABICompliance);
-    }
-
     return changed;
 }
 
@@ -233,18 +244,17 @@ bool BlockVarRenamePass::subscriptUsedLocations(SharedStmt stmt)
             continue; // Don't re-rename the renamed variable
         }
 
-        if (!STACKS_EMPTY(location)) {
-            def = stacks[location].top();
-        }
-        else if (!STACKS_EMPTY(defineAll)) {
-            def = stacks[defineAll].top();
+        def = getLastDef(location);
+
+        if (def == nullptr) {
+            def = getLastDef(defineAll);
         }
-        else {
+
+        if (def == nullptr) {
             // If the both stacks are empty, use a nullptr definition. This will be changed
             // into a pointer to an implicit definition at the start of type analysis, but
             // not until all the m[...] have stopped changing their expressions (complicates
             // implicit assignments considerably).
-            def = nullptr;
             // Update the collector at the start of the UserProc
             proc->markAsInitialParam(location->clone());
         }
@@ -285,16 +295,7 @@ void BlockVarRenamePass::pushDefinitions(SharedStmt stmt, bool assumeABIComplian
 
         if (suitable) {
             // Push i onto Stacks[a]
-            // Note: we clone a because otherwise it could be an expression
-            // that gets deleted through various modifications.
-            // This is necessary because we do several passes of this algorithm
-            // to sort out the memory expressions.
-            if (stacks.find(a) != stacks.end()) { // expression exists, no need for clone ?
-                stacks[a].push(stmt);
-            }
-            else {
-                stacks[a->clone()].push(stmt);
-            }
+            pushDef(getVarID(a), stmt);
 
             // Replace definition of 'a' with definition of a_i in S (we don't do this)
         }
@@ -306,7 +307,7 @@ void BlockVarRenamePass::pushDefinitions(SharedStmt stmt, bool assumeABIComplian
 
             // Stacks already has a definition for a (as just the bare local)
             if (suitable) {
-                stacks[a1->clone()].push(stmt);
+                pushDef(getVarID(a1->clone()), stmt);
             }
         }
     }
@@ -316,45 +317,79 @@ void BlockVarRenamePass::pushDefinitions(SharedStmt stmt, bool assumeABIComplian
     if (stmt->isCall() && stmt->as<CallStatement>()->isChildless() &&
         !proc->getProg()->getProject()->getSettings()->assumeABI) {
         // S is a childless call (and we're not assuming ABI compliance)
-        stacks[defineAll]; // Ensure that there is an entry for defineAll
+        getVarID(defineAll); // Ensure that there is an entry for defineAll
 
-        for (auto &elem : stacks) {
-            // if (dd->first->isMemDepth(memDepth))
-            elem.second.push(stmt); // Add a definition for all vars
+        for (std::size_t varID = 0; varID < m_defStacks.size(); ++varID) {
+            pushDef(varID, stmt); // Add a definition for all vars
         }
     }
 }
 
 
-void BlockVarRenamePass::popDefinitions(SharedStmt stmt, bool assumeABICompliance)
+void BlockVarRenamePass::popDefinitions(std::size_t undoLogSize)
 {
-    UserProc *proc = stmt->getProc();
+    // NOTE: Because of the need to pop childless calls from the Stacks, it is important in my
+    // algorithm to process the statments in the fragments *backwards*.
+    // (It is not important in Appel's algorithm, since he always pushes a definition
+    // for every variable defined on the Stacks).
+    while (m_undoLog.size() > undoLogSize) {
+        std::vector<SharedStmt> &stack = m_defStacks[m_undoLog.back()];
+        assert(!stack.empty());
 
-    // For each definition of some variable a in S
-    LocationSet defs;
-    stmt->getDefinitions(defs, assumeABICompliance);
+        stack.pop_back();
+        m_undoLog.pop_back();
+    }
+}
 
-    for (const auto &def : defs) {
-        if (!proc->canRename(def)) {
-            continue;
-        }
 
-        auto stackIt = stacks.find(def);
-        if (stackIt == stacks.end() || stackIt->second.empty()) {
-            LOG_FATAL("Tried to pop '%1' from Stacks; does not exist", def);
+void BlockVarRenamePass::updateDefs(DefCollector *col, UserProc *proc) const
+{
+    for (const auto &[var, varID] : m_varIDs) {
+        const std::vector<SharedStmt> &stack = m_defStacks[varID];
+        if (stack.empty()) {
+            continue; // This variable's definition doesn't reach here
         }
 
-        stackIt->second.pop();
+        // Create an assignment of the form loc := loc{def}
+        auto re = RefExp::get(var->clone(), stack.back());
+        std::shared_ptr<Assign> as(new Assign(var->clone(), re));
+        as->setProc(proc); // Simplify sometimes needs this
+        col->collectDef(as);
     }
+}
 
-    // Pop all defs due to childless calls
-    if (stmt->isCall() && stmt->as<CallStatement>()->isChildless()) {
-        for (auto &[var, lastDef] : stacks) {
-            Q_UNUSED(var);
 
-            if (!lastDef.empty() && (lastDef.top() == stmt)) {
-                lastDef.pop();
-            }
-        }
+SharedStmt BlockVarRenamePass::getLastDef(const SharedExp &var) const
+{
+    auto it = m_varIDs.find(var);
+    if (it == m_varIDs.end() || m_defStacks[it->second].empty()) {
+        return nullptr;
     }
+
+    return m_defStacks[it->second].back();
+}
+
+
+std::size_t BlockVarRenamePass::getVarID(const SharedExp &var)
+{
+    auto it = m_varIDs.find(var);
+    if (it != m_varIDs.end()) {
+        return it->second;
+    }
+
+    // Note: we clone var because otherwise it could be an expression
+    // that gets deleted through various modifications.
+    // This is necessary because we do several passes of this algorithm
+    // to sort out the memory expressions.
+    const std::size_t varID = m_defStacks.size();
+    m_varIDs.insert({ var->clone(), varID });
+    m_defStacks.emplace_back();
+    return varID;
+}
+
+
+void BlockVarRenamePass::pushDef(std::size_t varID, const SharedStmt &def)
+{
+    m_defStacks[varID].push_back(def);
+    m_undoLog.push_back(varID);
 }
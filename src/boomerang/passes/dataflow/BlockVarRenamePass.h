@@ -10,12 +10,16 @@
 #pragma once
 
 
+#include "boomerang/db/DataFlow.h"
 #include "boomerang/passes/Pass.h"
 #include "boomerang/ssl/exp/ExpHelp.h"
 #include "boomerang/ssl/statements/Statement.h"
 
 #include <map>
-#include <stack>
+#include <vector>
+
+
+class DefCollector;
 
 
 /// Rewrites Statements in BasicBlocks into SSA form.
@@ -29,7 +33,13 @@ public:
     bool execute(UserProc *proc) override;
 
 private:
-    bool renameBlockVars(UserProc *proc, std::size_t n);
+    /// Rename the variables in the dominator tree rooted at fragment \p entryIdx.
+    /// The dominator tree is walked iteratively, so deep trees do not exhaust the call stack.
+    bool renameBlockVars(UserProc *proc, FragIndex entryIdx);
+
+    /// Rename all variables in fragment \p n and update the phis of its successors.
+    /// Definitions in this fragment are left on the stacks.
+    bool renameFragment(UserProc *proc, FragIndex n, bool assumeABI);
 
     /// For all expressions in \p stmt, replace \p var with var{varDef}
     void subscriptVar(const SharedStmt &stmt, SharedExp var, const SharedStmt &varDef);
@@ -39,10 +49,27 @@ private:
     /// push definitions in this statement onto the stacks
     void pushDefinitions(SharedStmt stmt, bool assumeABI);
 
-    /// pop definitions in this statement from the stacks
-    void popDefinitions(SharedStmt stmt, bool assumeABI);
+    /// pop all definitions pushed after the undo log had size \p undoLogSize
+    void popDefinitions(std::size_t undoLogSize);
+
+    /// Add the definitions reaching the current statement to \p col
+    void updateDefs(DefCollector *col, UserProc *proc) const;
+
+    /// \returns the last definition of \p var, or nullptr if there is none
+    SharedStmt getLastDef(const SharedExp &var) const;
+
+    /// \returns the ID of \p var, assigning a new ID if \p var has not been seen yet
+    std::size_t getVarID(const SharedExp &var);
+
+    void pushDef(std::size_t varID, const SharedStmt &def);
 
 private:
-    /// stores the last definition of a variable
-    std::map<SharedExp, std::stack<SharedStmt>, lessExpStar> stacks;
+    /// The ID of each variable that has been defined so far
+    std::map<SharedExp, std::size_t, lessExpStar> m_varIDs;
+
+    /// Stores the definitions of each variable (by ID), the last definition is at the back
+    std::vector<std::vector<SharedStmt>> m_defStacks;
+
+    /// IDs of the variables pushed onto \ref m_defStacks, in the order of pushing
+    std::vector<std::size_t> m_undoLog;
 };
@@ -35,6 +35,11 @@ void RegDB::clear()
     m_regNums.clear();
     m_regInfo.clear();
     m_specialRegInfo.clear();
+
+    m_parent.clear();
+    m_offsetInParent.clear();
+    m_children.clear();
+    m_aliases.clear();
 }
 
 
@@ -157,9 +162,38 @@ bool RegDB::createRegRelation(const QString &parent, const QString &child, int o
         return false;
     }
 
+    const RegNum parentNum = getRegNumByName(parent);
+    const RegNum childNum  = getRegNumByName(child);
+
+    if (childNum != RegNumSpecial) {
+        if (parentNum == childNum) {
+            // parent and child are aliases of each other
+            return false;
+        }
+
+        const std::size_t minSize = std::max(parentNum, childNum) + 1;
+        if (m_aliases.size() < minSize) {
+            m_aliases.resize(minSize);
+        }
+
+        if (m_aliases[childNum].parent != RegNumSpecial) {
+            // relation already exists for an alias of child
+            return false;
+        }
+    }
+
     m_parent[child]                    = parent;
     m_offsetInParent[child]            = offsetInParent;
     m_children[parent][offsetInParent] = child;
+
+    if (childNum != RegNumSpecial) {
+        m_aliases[childNum].parent                    = parentNum;
+        m_aliases[childNum].offsetInParent            = offsetInParent;
+        m_aliases[parentNum].children[offsetInParent] = childNum;
+
+        rebuildOverlapTables(parentNum);
+    }
+
     return true;
 }
 
@@ -180,117 +214,121 @@ std::unique_ptr<RTL> RegDB::processOverlappedRegs(const std::shared_ptr<Assignme
     }
 
     std::unique_ptr<RTL> result = std::make_unique<RTL>(Address::ZERO);
+    if (myNum >= m_aliases.size()) {
+        return result; // register does not overlap with any other register
+    }
+
+    const SharedConstExp guard = stmt->isAssign() ? stmt->as<const Assign>()->getGuard()
+                                                  : nullptr;
+
+    for (const OverlapEntry &entry : m_aliases[myNum].overlaps) {
+        // is the overlapping register actually used? if not, then skip
+        if (usedRegs.find(entry.affectedReg) == usedRegs.end()) {
+            continue;
+        }
+
+        std::shared_ptr<Assign> overlapAsgn = std::make_shared<Assign>(*entry.tmpl);
+        if (guard) {
+            overlapAsgn->setGuard(guard->clone());
+            overlapAsgn->simplify();
+        }
+
+        result->append(overlapAsgn);
+    }
+
+    return result;
+}
+
+
+void RegDB::rebuildOverlapTables(RegNum regNum)
+{
+    RegNum root = regNum;
+    while (m_aliases[root].parent != RegNumSpecial) {
+        root = m_aliases[root].parent;
+    }
+
+    std::stack<RegNum> toUpdate({ root });
+
+    while (!toUpdate.empty()) {
+        const RegNum base = toUpdate.top();
+        toUpdate.pop();
+
+        std::vector<OverlapEntry> &overlaps = m_aliases[base].overlaps;
+        overlaps.clear();
 
-    try {
         // first process the effects of assignment "up" the register forest
         // e.g. the effects on %eax when assigning to %ah
-        {
-            const Register *base  = getRegByNum(myNum);
-            const Register *child = base;
-            int offsetInParent    = 0;
-
-            while (child != nullptr) {
-                const bool hasParent = m_parent.find(child->getName()) != m_parent.end();
-                if (!hasParent) {
-                    break; // reached top of tree
-                }
-                const Register *parent = getRegByName(m_parent.at(child->getName()));
-                assert(parent != nullptr);
-
-                offsetInParent += m_offsetInParent.at(child->getName());
-                const RegNum parentID = getRegNumByName(parent->getName());
-
-                // is the parent actually used? if not, then skip
-                if (usedRegs.find(parentID) != usedRegs.end()) {
-                    std::shared_ptr<Assignment> overlapAsgn(
-                        emitOverlappedStmt(stmt, parent, base, offsetInParent));
-                    if (overlapAsgn) {
-                        result->append(overlapAsgn);
-                    }
-                }
-                child = parent; // up one level
+        int offsetInParent = 0;
+        for (RegNum child = base; m_aliases[child].parent != RegNumSpecial;
+             child        = m_aliases[child].parent) {
+            offsetInParent += m_aliases[child].offsetInParent;
+            const RegNum parent = m_aliases[child].parent;
+
+            std::shared_ptr<Assign> tmpl = emitOverlappedStmt(parent, base, offsetInParent);
+            if (tmpl) {
+                overlaps.push_back({ parent, tmpl });
             }
         }
 
         // now process the effects of assignment "down" the register tree
         // e.g. the effects on %ah when assigning to %eax
-        {
-            const Register *base = getRegByNum(myNum);
-            std::stack<std::pair<const Register *, int>> toVisit({ { base, 0 } });
-
-            while (!toVisit.empty()) {
-                const auto &[current, offset] = toVisit.top();
-                toVisit.pop();
-
-                if (current != base) {
-                    const RegNum currentID = getRegNumByName(current->getName());
-
-                    if (m_offsetInParent.find(current->getName()) != m_offsetInParent.end()) {
-                        // is the parent actually used? if not, then skip
-                        if (usedRegs.find(currentID) != usedRegs.end()) {
-                            std::shared_ptr<Assignment> overlapAsgn(
-                                emitOverlappedStmt(stmt, current, base, offset));
-                            if (overlapAsgn) {
-                                result->append(overlapAsgn);
-                            }
-                        }
-                    }
-                }
+        std::stack<std::pair<RegNum, int>> toVisit({ { base, 0 } });
 
-                if (m_children.find(current->getName()) != m_children.end()) {
-                    // recurse to children if there are any
-                    for (const auto &[childOffset, child] : m_children.at(current->getName())) {
-                        toVisit.push({ getRegByName(child), offset + childOffset });
-                    }
+        while (!toVisit.empty()) {
+            const auto [current, offset] = toVisit.top();
+            toVisit.pop();
+
+            if (current != base) {
+                std::shared_ptr<Assign> tmpl = emitOverlappedStmt(current, base, offset);
+                if (tmpl) {
+                    overlaps.push_back({ current, tmpl });
                 }
             }
+
+            for (const auto &[childOffset, child] : m_aliases[current].children) {
+                toVisit.push({ child, offset + childOffset });
+            }
         }
-    }
-    catch (std::out_of_range &) {
-        assert(false);
-    }
 
-    return result;
+        for (const auto &[childOffset, child] : m_aliases[base].children) {
+            Q_UNUSED(childOffset);
+            toUpdate.push(child);
+        }
+    }
 }
 
 
-std::shared_ptr<Assignment> RegDB::emitOverlappedStmt(const std::shared_ptr<Assignment> &original,
-                                                      const Register *lhs, const Register *rhs,
-                                                      int offsetInParent) const
+std::shared_ptr<Assign> RegDB::emitOverlappedStmt(RegNum lhsID, RegNum rhsID,
+                                                  int offsetInParent) const
 {
-    const RegNum lhsID = getRegNumByName(lhs->getName());
-    const RegNum rhsID = getRegNumByName(rhs->getName());
-
     if (lhsID == RegNumSpecial || rhsID == RegNumSpecial) {
         return nullptr;
     }
 
     assert(lhsID != rhsID);
+    const int lhsSize = getRegSizeByNum(lhsID);
+    const int rhsSize = getRegSizeByNum(rhsID);
 
     std::shared_ptr<Assign> result = nullptr;
-    if (lhs->getSize() <= rhs->getSize()) {
+    if (lhsSize <= rhsSize) {
         // emit lhs = rhs@[offset:(offset + lhs->size -1)]
-        result.reset(
-            new Assign(IntegerType::get(lhs->getSize()), Location::regOf(lhsID),
-                       Ternary::get(opAt, Location::regOf(rhsID), Const::get(offsetInParent),
-                                    Const::get(offsetInParent + lhs->getSize() - 1))));
+        result.reset(new Assign(IntegerType::get(lhsSize), Location::regOf(lhsID),
+                                Ternary::get(opAt, Location::regOf(rhsID),
+                                             Const::get(offsetInParent),
+                                             Const::get(offsetInParent + lhsSize - 1))));
     }
     else {
-        const unsigned int mask = ~(Util::getLowerBitMask(rhs->getSize()) << offsetInParent);
+        const unsigned int mask = ~(Util::getLowerBitMask(rhsSize) << offsetInParent);
 
         // emit lhs := (lhs & mask) | (zfill(rhs) << offset)
         result.reset(new Assign(
-            IntegerType::get(lhs->getSize()), Location::regOf(lhsID),
-            Binary::get(
-                opBitOr, Binary::get(opBitAnd, Location::regOf(lhsID), Const::get(mask)),
-                Binary::get(opShL,
-                            Ternary::get(opZfill, Const::get(rhs->getSize()),
-                                         Const::get(lhs->getSize()), Location::regOf(rhsID)),
-                            Const::get(offsetInParent)))));
-    }
-
-    if (original->isAssign() && original->as<const Assign>()->getGuard()) {
-        result->setGuard(original->as<const Assign>()->getGuard()->clone());
+            IntegerType::get(lhsSize), Location::regOf(lhsID),
+            Binary::get(opBitOr,
+                        Binary::get(opBitAnd, Location::regOf(lhsID), Const::get(mask)),
+                        Binary::get(opShL,
+                                    Ternary::get(opZfill, Const::get(rhsSize), Const::get(lhsSize),
+                                                 Location::regOf(rhsID)),
+                                    Const::get(offsetInParent)))));
     }
 
     result->simplify();
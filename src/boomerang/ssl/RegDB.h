@@ -15,8 +15,10 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 
+class Assign;
 class Assignment;
 
 
@@ -84,6 +86,9 @@ public:
     ///               may be RegNumSpecial (but should be >= 0).
     /// \param offsetInParent Offset (in bits) of the child register.
     /// \returns true on success, false on failure.
+    /// \note This also updates the precomputed overlap tables of all registers
+    /// in the register tree of \p parent, so this should only be used while loading
+    /// the register specification.
     bool createRegRelation(const QString &parent, const QString &child, int offsetInParent);
 
     /// Process the effects of overlapped registers for \p stmt.
@@ -101,6 +106,9 @@ public:
                                                const std::set<RegNum> &usedRegs) const;
 
 private:
+    /// Recompute the overlap tables of all registers in the register tree containing \p regNum.
+    void rebuildOverlapTables(RegNum regNum);
+
     /// Emit a new statement assigning the content of \p rhs into \p lhs.
     /// There are 2 cases:
     ///  1. The LHS is larger. In this case, assign only the bits of \p lhs
@@ -110,14 +118,11 @@ private:
     ///  2. The RHS is larger. In this case, use only the bits of the RHS
     ///     that also belong to \p lhs. (e.g. %ah := %eax@[8..15])
     ///
-    /// \param original The orignal assignment
     /// \param lhs The register that is assigned to
     /// \param rhs The register that is assigned from
     /// \param offsetInParent The offset in bits of the child register (for %eax -> %ah this is 8)
-    /// \returns the new register content mapping assignment.
-    std::shared_ptr<Assignment> emitOverlappedStmt(const std::shared_ptr<Assignment> &original,
-                                                   const Register *lhs, const Register *rhs,
-                                                   int offsetInParent) const;
+    /// \returns the new register content mapping assignment (without guard).
+    std::shared_ptr<Assign> emitOverlappedStmt(RegNum lhs, RegNum rhs, int offsetInParent) const;
 
 private:
     /// A map from the symbolic representation of a register (e.g. "%g0")
@@ -138,4 +143,27 @@ private:
     std::map<QString, QString> m_parent;                  ///< child -> parent
     std::map<QString, int> m_offsetInParent;              ///< child -> offset (if parent exists)
     std::map<QString, std::map<int, QString>> m_children; ///< parent -> (offset -> child)
+
+    /// The effect of an assignment to a register on one of its overlapping registers.
+    struct OverlapEntry
+    {
+        RegNum affectedReg;           ///< the overlapping register
+        std::shared_ptr<Assign> tmpl; ///< template statement updating \ref affectedReg
+    };
+
+    /// Register coverage information of a single (non-special) register.
+    struct RegAliasInfo
+    {
+        RegNum parent      = RegNumSpecial; ///< RegNumSpecial if there is no parent
+        int offsetInParent = 0;
+        std::map<int, RegNum> children; ///< offset -> child
+
+        /// Effects of an assignment to this register on all overlapping registers,
+        /// first "up" the register tree, then "down" the register tree.
+        std::vector<OverlapEntry> overlaps;
+    };
+
+    /// Register coverage information indexed by RegNum, precomputed from the relations above
+    /// so overlapped register processing does not have to look up anything by name.
+    std::vector<RegAliasInfo> m_aliases;
 };
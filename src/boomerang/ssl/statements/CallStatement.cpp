@@ -1060,23 +1060,26 @@ bool CallStatement::doEllipsisProcessing()
         return true;
     }
 
-    // actually have to parse it
+    // Format strings are usually used by many calls, so they are only parsed once per program
     const bool isScanf = calleeName.contains("scanf");
-    const int n        = parseFmtStr(formatStr, isScanf);
+    Prog *prog         = m_proc ? m_proc->getProg() : nullptr;
 
-    assert(n >= 0);
+    const std::vector<SharedType> argTypes = prog
+                                                 ? prog->getFormatStringArgTypes(formatStr, isScanf)
+                                                 : parseFmtStr(formatStr, isScanf);
 
-    setNumArguments((formatstrIdx + 1) + n);
+    addSigParams(argTypes);
+    setNumArguments((formatstrIdx + 1) + static_cast<int>(argTypes.size()));
     m_signature->setHasEllipsis(false); // So we don't do this again
 
     return true;
 }
 
 
-int CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
+std::vector<SharedType> CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
 {
     // clang-format off
-    const QRegularExpression re(
+    static const QRegularExpression re(
         "%("                                 // '%' followed by either ...
           "(?<flags>[+-0 #]*)"               //   flags (opt), ...
           "(?<width>([0-9\\*]*))"            //   width (opt, digits or *), ...
@@ -1088,8 +1091,14 @@ int CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
         ")");
     // clang-format on
 
+    std::vector<SharedType> types;
+
+    // If addPointer is true, add type 'ty *' instead of type 'ty'
+    auto addType = [&types](SharedType ty, bool addPointer) {
+        types.push_back(addPointer ? PointerType::get(ty) : ty);
+    };
+
     auto it = re.globalMatch(fmtStr);
-    int n   = 0;
 
     while (it.hasNext()) {
         auto match = it.next();
@@ -1102,12 +1111,10 @@ int CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
 
         if (isScanf && list != "") {
             if (list[0] == "l") {
-                addSigParam(ArrayType::get(IntegerType::get(16, Sign::Signed)), true); // wchar_t
-                n++;
+                addType(ArrayType::get(IntegerType::get(16, Sign::Signed)), true); // wchar_t
             }
             else {
-                addSigParam(ArrayType::get(CharType::get()), true);
-                n++;
+                addType(ArrayType::get(CharType::get()), true);
             }
 
             continue;
@@ -1119,49 +1126,39 @@ int CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
         }
 
         if (width == "*") {
-            addSigParam(IntegerType::get(32, Sign::Signed), false);
-            n++;
+            addType(IntegerType::get(32, Sign::Signed), false);
         }
 
         if (prec == ".*") {
-            addSigParam(IntegerType::get(32, Sign::Signed), false);
-            n++;
+            addType(IntegerType::get(32, Sign::Signed), false);
         }
 
         switch (spec[0].toLatin1()) {
         case 'd':
         case 'i':
             if (mod == "") {
-                addSigParam(IntegerType::get(32, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(32, Sign::Signed), isScanf);
             }
             else if (mod == "hh") {
-                addSigParam(IntegerType::get(8, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(8, Sign::Signed), isScanf);
             }
             else if (mod == "h") {
-                addSigParam(IntegerType::get(16, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(16, Sign::Signed), isScanf);
             }
             else if (mod == "l") {
-                addSigParam(IntegerType::get(32, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(32, Sign::Signed), isScanf);
             }
             else if (mod == "ll") {
-                addSigParam(IntegerType::get(64, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(64, Sign::Signed), isScanf);
             }
             else if (mod == "j") {
-                addSigParam(IntegerType::get(32, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(32, Sign::Signed), isScanf);
             }
             else if (mod == "z") { // size_t
-                addSigParam(IntegerType::get(STD_SIZE, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(STD_SIZE, Sign::Unsigned), isScanf);
             }
             else if (mod == "t") { // ptrdiff_t
-                addSigParam(IntegerType::get(STD_SIZE, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(STD_SIZE, Sign::Signed), isScanf);
             }
             break;
 
@@ -1174,36 +1171,28 @@ int CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
         case 'o':
         case 'x':
             if (mod == "") {
-                addSigParam(IntegerType::get(32, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(32, Sign::Unsigned), isScanf);
             }
             else if (mod == "hh") {
-                addSigParam(IntegerType::get(8, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(8, Sign::Unsigned), isScanf);
             }
             else if (mod == "h") {
-                addSigParam(IntegerType::get(16, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(16, Sign::Unsigned), isScanf);
             }
             else if (mod == "l") {
-                addSigParam(IntegerType::get(32, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(32, Sign::Unsigned), isScanf);
             }
             else if (mod == "ll") {
-                addSigParam(IntegerType::get(64, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(64, Sign::Unsigned), isScanf);
             }
             else if (mod == "j") {
-                addSigParam(IntegerType::get(32, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(32, Sign::Unsigned), isScanf);
             }
             else if (mod == "z") { // size_t
-                addSigParam(IntegerType::get(STD_SIZE, Sign::Unsigned), isScanf);
-                n++;
+                addType(IntegerType::get(STD_SIZE, Sign::Unsigned), isScanf);
             }
             else if (mod == "t") { // ptrdiff_t
-                addSigParam(IntegerType::get(STD_SIZE, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(STD_SIZE, Sign::Signed), isScanf);
             }
             break;
 
@@ -1220,80 +1209,64 @@ int CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
         case 'e':
         case 'g':
             if (mod == "") {
-                addSigParam(FloatType::get(isScanf ? 32 : 64), isScanf);
-                n++;
+                addType(FloatType::get(isScanf ? 32 : 64), isScanf);
             }
             else if (mod == "L") {
-                addSigParam(FloatType::get(128), isScanf);
-                n++;
+                addType(FloatType::get(128), isScanf);
             }
             else if (mod == "l" && isScanf) {
-                addSigParam(FloatType::get(64), true);
-                n++;
+                addType(FloatType::get(64), true);
             }
             break;
 
         case 'c':
             if (mod == "") {
-                addSigParam(CharType::get(), isScanf);
-                n++;
+                addType(CharType::get(), isScanf);
             }
             else if (mod == "l") {
-                addSigParam(IntegerType::get(16, Sign::Signed), isScanf);
-                n++;
+                addType(IntegerType::get(16, Sign::Signed), isScanf);
             }
             break;
 
         case 's':
             if (mod == "") {
-                addSigParam(ArrayType::get(CharType::get()), true);
-                n++;
+                addType(ArrayType::get(CharType::get()), true);
             }
             else if (mod == "l") {
-                addSigParam(ArrayType::get(IntegerType::get(16, Sign::Signed)), true);
-                n++;
+                addType(ArrayType::get(IntegerType::get(16, Sign::Signed)), true);
             }
             break;
 
         case 'p':
             if (mod == "") {
-                addSigParam(PointerType::get(VoidType::get()), isScanf);
-                n++;
+                addType(PointerType::get(VoidType::get()), isScanf);
             }
             break;
 
         case 'n':
             if (mod == "") {
-                addSigParam(IntegerType::get(32, Sign::Signed), true);
-                n++;
+                addType(IntegerType::get(32, Sign::Signed), true);
             }
             else if (mod == "hh") {
-                addSigParam(IntegerType::get(8, Sign::Signed), true);
-                n++;
+                addType(IntegerType::get(8, Sign::Signed), true);
             }
             else if (mod == "h") {
-                addSigParam(IntegerType::get(16, Sign::Signed), true);
-                n++;
+                addType(IntegerType::get(16, Sign::Signed), true);
             }
             else if (mod == "l") {
-                addSigParam(IntegerType::get(32, Sign::Signed), true);
-                n++;
+                addType(IntegerType::get(32, Sign::Signed), true);
             }
             else if (mod == "ll") {
-                addSigParam(IntegerType::get(64, Sign::Signed), true);
-                n++;
+                addType(IntegerType::get(64, Sign::Signed), true);
             }
             else if (mod == "j") {
-                addSigParam(IntegerType::get(32, Sign::Signed), true);
-                n++;
+                addType(IntegerType::get(32, Sign::Signed), true);
             }
             else if (mod == "z") { // size_t
-                addSigParam(IntegerType::get(STD_SIZE, Sign::Unsigned), true);
-                n++;
+                addType(IntegerType::get(STD_SIZE, Sign::Unsigned), true);
             }
             else if (mod == "t") { // ptrdiff_t
-                addSigParam(IntegerType::get(STD_SIZE, Sign::Signed), true);
-                n++;
+                addType(IntegerType::get(STD_SIZE, Sign::Signed), true);
             }
             break;
 
@@ -1301,7 +1274,7 @@ int CallStatement::parseFmtStr(const QString &fmtStr, bool isScanf)
         }
     }
 
-    return n;
+    return types;
 }
 
 
@@ -1509,6 +1482,29 @@ void CallStatement::addSigParam(SharedType ty, bool isScanf)
 }
 
 
+void CallStatement::addSigParams(const std::vector<SharedType> &types)
+{
+    const int firstNewParam = m_signature->getNumParams();
+
+    for (const SharedType &ty : types) {
+        m_signature->addParameter(nullptr, ty->clone());
+    }
+
+    // Add all missing arguments at once
+    for (int i = firstNewParam; i < m_signature->getNumParams(); i++) {
+        const SharedType ty = m_signature->getParamType(i);
+        SharedExp paramExp  = m_signature->getParamExp(i);
+
+        LOG_VERBOSE("EllipsisProcessing: adding parameter %1 of type %2", paramExp,
+                    ty->getCtype());
+
+        if (static_cast<int>(m_arguments.size()) <= i) {
+            m_arguments.append(std::shared_ptr<Assign>(makeArgAssign(ty, paramExp)));
+        }
+    }
+}
+
+
 std::shared_ptr<Assign> CallStatement::makeArgAssign(SharedType ty, SharedExp e)
 {
     SharedExp lhs = e->clone();
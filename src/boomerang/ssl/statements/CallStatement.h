@@ -230,17 +230,20 @@ public:
     /// \returns true if converted
     bool tryConvertToDirect();
 
+    /// Parses the printf or scanf style format string \p fmtStr.
+    /// \returns the types of all arguments consumed by the format string, in order.
+    static std::vector<SharedType> parseFmtStr(const QString &fmtStr, bool isScanf);
+
 private:
     bool doObjCEllipsisProcessing(const QString &formatStr);
 
-    /// Parses the format string and extracts all signature types.
-    /// \returns the number of new types added, or -1 on failure.
-    int parseFmtStr(const QString &fmtStr, bool isScanf);
-
     /// Private helper functions for the above
     /// If addPointer is true, add type 'ty *' to the signature instead of type 'ty'
     void addSigParam(SharedType ty, bool addPointer);
 
+    /// Add parameters of types \p types (and the corresponding arguments) to the signature
+    void addSigParams(const std::vector<SharedType> &types);
+
     /// Make an assign suitable for use as an argument from a callee context expression
     std::shared_ptr<Assign> makeArgAssign(SharedType ty, SharedExp e);
 
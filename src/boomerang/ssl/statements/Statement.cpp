@@ -25,9 +25,13 @@
 #include "boomerang/visitor/stmtexpvisitor/UsedLocsVisitor.h"
 #include "boomerang/visitor/stmtmodifier/StmtPartModifier.h"
 
+#include <atomic>
+
 
 SharedStmt Statement::wild = SharedStmt(new Assign(Terminal::get(opNil), Terminal::get(opNil)));
-static uint32 m_nextStmtID = 0;
+
+/// IDs for statements that are not part of a proc, see Statement::getID
+static std::atomic<uint32> nextGlobalStmtID(0);
 
 
 Statement::Statement(StmtType kind)
@@ -36,7 +40,6 @@ Statement::Statement(StmtType kind)
     , m_number(0)
     , m_kind(kind)
 {
-    m_id = m_nextStmtID++;
 }
 
 
@@ -47,7 +50,9 @@ Statement::Statement(const Statement &other)
     , m_number(other.m_number)
     , m_kind(other.m_kind)
 {
-    m_id = m_nextStmtID++;
+    if (m_proc) {
+        assignID();
+    }
 }
 
 
@@ -57,10 +62,15 @@ Statement &Statement::operator=(const Statement &other)
         return *this;
     }
 
-    m_fragment = other.m_fragment;
-    m_proc     = other.m_proc;
-    m_number   = other.m_number;
-    m_id       = m_nextStmtID++;
+    m_fragment   = other.m_fragment;
+    m_proc       = other.m_proc;
+    m_number     = other.m_number;
+    m_idProcAddr = Address::INVALID;
+    m_id         = (uint32)-1;
+
+    if (m_proc) {
+        assignID();
+    }
 
     return *this;
 }
@@ -68,13 +78,44 @@ Statement &Statement::operator=(const Statement &other)
 
 bool Statement::operator==(const Statement &rhs) const
 {
-    return getID() == rhs.getID();
+    return getID() == rhs.getID() && m_idProcAddr == rhs.m_idProcAddr;
 }
 
 
 bool Statement::operator<(const Statement &rhs) const
 {
-    return getID() < rhs.getID();
+    // getID() assigns m_idProcAddr as well
+    const uint32 id    = getID();
+    const uint32 rhsID = rhs.getID();
+
+    if (m_idProcAddr != rhs.m_idProcAddr) {
+        return m_idProcAddr < rhs.m_idProcAddr;
+    }
+
+    return id < rhsID;
+}
+
+
+uint32 Statement::getID() const
+{
+    if (m_id == (uint32)-1) {
+        assignID();
+    }
+
+    return m_id;
+}
+
+
+void Statement::assignID() const
+{
+    if (m_proc && m_proc->getEntryAddress() != Address::INVALID) {
+        m_idProcAddr = m_proc->getEntryAddress();
+        m_id         = m_proc->allocateStmtID();
+    }
+    else {
+        m_idProcAddr = Address::INVALID;
+        m_id         = nextGlobalStmtID++;
+    }
 }
 
 
@@ -82,6 +123,16 @@ void Statement::setProc(UserProc *proc)
 {
     m_proc = proc;
 
+    if (proc) {
+        if (m_id == (uint32)-1) {
+            assignID();
+        }
+
+        if (m_number <= 0) {
+            setNumber(proc->allocateStmtNumber());
+        }
+    }
+
     const bool assumeABICompliance = (proc && proc->getProg())
                                          ? proc->getProg()->getProject()->getSettings()->assumeABI
                                          : false;
@@ -131,11 +131,16 @@ public:
     /// Make copy of self, and make the copy a derived object if needed.
     virtual SharedStmt clone() const = 0;
 
-    uint32 getID() const
-    {
-        assert(m_id != (uint32)-1);
-        return m_id;
-    }
+    /**
+     * \returns the ID of this statement, which is unique among the statements of its proc.
+     * Statements are ordered by the entry address of the proc that assigned the ID,
+     * then by the ID. The ID is assigned when the statement is first added to a proc
+     * (or when it is copied from a statement of a proc), so it only depends on the order
+     * in which the proc creates its statements, not on the order in which procs are decompiled.
+     * Statements that are compared before they are added to a proc get an ID
+     * from a global counter instead.
+     */
+    uint32 getID() const;
 
     /// \returns the fragment that this statement is part of.
     IRFragment *getFragment() { return m_fragment; }
@@ -315,11 +320,19 @@ private:
     /// \returns true if change
     bool replaceRef(SharedExp e, const std::shared_ptr<Assignment> &def);
 
+    /// Assign the ID of this statement from its proc, or from the global counter
+    /// if it is not part of a proc yet.
+    void assignID() const;
+
 protected:
     IRFragment *m_fragment = nullptr; ///< contains a pointer to the enclosing fragment
     UserProc *m_proc       = nullptr; ///< procedure containing this statement
     int m_number           = -1;      ///< Statement number for printing
-    uint32 m_id            = (uint32)-1;
+
+    /// Entry address of the proc that assigned m_id, or Address::INVALID if it was
+    /// assigned from the global counter.
+    mutable Address m_idProcAddr = Address::INVALID;
+    mutable uint32 m_id          = (uint32)-1; ///< see getID
 
     StmtType m_kind = StmtType::INVALID; ///< Statement kind (e.g. StmtType::Branch)
 };
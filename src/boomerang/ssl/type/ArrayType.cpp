@@ -71,6 +71,7 @@ void ArrayType::setBaseType(SharedType b)
     }
 
     m_baseType = b;
+    invalidateSizes();
 }
 
 
@@ -69,7 +69,11 @@ public:
 
     /// \returns the number of elements in this array.
     uint64 getLength() const { return m_length; }
-    void setLength(unsigned n) { m_length = n; }
+    void setLength(unsigned n)
+    {
+        m_length = n;
+        invalidateSizes();
+    }
 
     /// \returns true iff we do not know the length of the array (yet)
     bool isUnbounded() const;
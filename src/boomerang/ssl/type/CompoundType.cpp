@@ -10,7 +10,8 @@
 #include "CompoundType.h"
 
 #include "boomerang/ssl/type/SizeType.h"
-#include "boomerang/util/Util.h"
+
+#include <algorithm>
 
 
 CompoundType::CompoundType()
@@ -44,14 +45,43 @@ bool CompoundType::isCompatibleWith(const Type &other, bool all) const
 
 Type::Size CompoundType::getSize() const
 {
-    Size size = 0;
+    updateOffsets();
+    return m_offsets.back();
+}
+
+
+void CompoundType::updateOffsets() const
+{
+    if (m_offsetsGeneration == getSizeGeneration() && m_offsets.size() == m_types.size() + 1) {
+        return;
+    }
 
-    for (const SharedType &elem : m_types) {
+    m_offsets.resize(m_types.size() + 1);
+
+    uint64 offset = 0;
+    for (size_t i = 0; i < m_types.size(); i++) {
+        m_offsets[i] = offset;
         // NOTE: this assumes no padding... perhaps explicit padding will be needed
-        size += elem->getSize();
+        offset += m_types[i]->getSize();
+    }
+
+    m_offsets.back()    = offset;
+    m_offsetsGeneration = getSizeGeneration();
+}
+
+
+int CompoundType::findMemberByOffset(uint64 bitOffset) const
+{
+    updateOffsets();
+
+    // last member starting at or before bitOffset; zero-sized members before it are skipped
+    auto it = std::upper_bound(m_offsets.begin(), m_offsets.end() - 1, bitOffset);
+    if (it == m_offsets.begin()) {
+        return -1;
     }
 
-    return size;
+    const int idx = std::distance(m_offsets.begin(), it) - 1;
+    return bitOffset < m_offsets[idx + 1] ? idx : -1;
 }
 
 
@@ -100,80 +130,43 @@ SharedType CompoundType::getMemberTypeByName(const QString &name)
 
 SharedType CompoundType::getMemberTypeByOffset(uint64 bitOffset)
 {
-    uint64 offset = 0;
-
-    for (auto &elem : m_types) {
-        if (Util::inRange(bitOffset, offset, offset + elem->getSize())) {
-            return elem;
-        }
-
-        offset += elem->getSize();
-    }
-
-    return nullptr;
+    const int idx = findMemberByOffset(bitOffset);
+    return idx != -1 ? m_types[idx] : nullptr;
 }
 
 
 void CompoundType::setMemberTypeByOffset(uint64 bitOffset, SharedType ty)
 {
-    uint64 offset = 0;
-
-    for (int i = 0; i < getNumMembers(); i++) {
-        if (Util::inRange(bitOffset, offset, offset + m_types[i]->getSize())) {
-            unsigned oldsz = m_types[i]->getSize();
-            m_types[i]     = ty;
-
-            if (ty->getSize() < oldsz) {
-                m_types.push_back(m_types[m_types.size() - 1]);
-                m_names.push_back(m_names[m_names.size() - 1]);
-
-                for (int _n = getNumMembers() - 1; _n > i; _n--) {
-                    m_types[_n] = m_types[_n - 1];
-                    m_names[_n] = m_names[_n - 1];
-                }
-
-                m_types[i + 1] = SizeType::get(oldsz - ty->getSize());
-                m_names[i + 1] = "pad";
-            }
+    const int i = findMemberByOffset(bitOffset);
+    if (i == -1) {
+        return;
+    }
 
-            return;
-        }
+    const Size oldsz = m_types[i]->getSize();
+    m_types[i]       = ty;
 
-        offset += m_types[i]->getSize();
+    if (ty->getSize() < oldsz) {
+        m_types.insert(m_types.begin() + i + 1, SizeType::get(oldsz - ty->getSize()));
+        m_names.insert(m_names.begin() + i + 1, "pad");
     }
+
+    invalidateSizes();
 }
 
 
 void CompoundType::setMemberNameByOffset(uint64 bitOffset, const QString &name)
 {
-    uint64 offset = 0;
-
-    for (int i = 0; i < getNumMembers(); i++) {
-        if (Util::inRange(bitOffset, offset, offset + m_types[i]->getSize())) {
-            m_names[i] = name;
-            return;
-        }
-
-        offset += m_types[i]->getSize();
+    const int idx = findMemberByOffset(bitOffset);
+    if (idx != -1) {
+        m_names[idx] = name;
     }
 }
 
 
 QString CompoundType::getMemberNameByOffset(uint64 n)
 {
-    uint64 offset = 0;
-
-    for (int i = 0; i < getNumMembers(); i++) {
-        // if (offset >= n && n < offset + types[i]->getSize())
-        if ((offset <= n) && (n < offset + m_types[i]->getSize())) {
-            // return getName(offset == n ? i : i - 1);
-            return m_names[i];
-        }
-
-        offset += m_types[i]->getSize();
-    }
-
-    return "";
+    const int idx = findMemberByOffset(n);
+    return idx != -1 ? m_names[idx] : "";
 }
 
 
@@ -181,25 +174,18 @@ uint64 CompoundType::getMemberOffsetByIdx(int n)
 {
     assert(n < getNumMembers());
 
-    uint64 offset = 0;
-    for (int i = 0; i < n; i++) {
-        offset += m_types[i]->getSize();
-    }
-
-    return offset;
+    updateOffsets();
+    return m_offsets[n];
 }
 
 
 uint64 CompoundType::getMemberOffsetByName(const QString &member)
 {
-    uint64 offset = 0;
-
     for (int i = 0; i < getNumMembers(); i++) {
         if (m_names[i] == member) {
-            return offset;
+            updateOffsets();
+            return m_offsets[i];
         }
-
-        offset += m_types[i]->getSize();
     }
 
     return static_cast<unsigned int>(-1);
@@ -208,20 +194,11 @@ uint64 CompoundType::getMemberOffsetByName(const QString &member)
 
 uint64 CompoundType::getOffsetRemainder(uint64 bitSize)
 {
-    uint64 remainder = bitSize;
-    uint64 offset    = 0;
-
-    for (auto &elem : m_types) {
-        offset += elem->getSize();
-
-        if (offset > bitSize) {
-            break;
-        }
+    updateOffsets();
 
-        remainder -= elem->getSize();
-    }
-
-    return remainder;
+    // end of the last member that ends at or before bitSize
+    auto it = std::upper_bound(m_offsets.begin() + 1, m_offsets.end(), bitSize);
+    return bitSize - *(it - 1);
 }
 
 
@@ -305,6 +282,9 @@ void CompoundType::addMember(SharedType memberType, const QString &memberName)
 
     m_types.push_back(memberType);
     m_names.push_back(memberName);
+
+    // this struct might be a member of another struct or union
+    invalidateSizes();
 }
 
 
@@ -92,7 +92,20 @@ protected:
     /// \copydoc Type::isCompatible
     bool isCompatible(const Type &other, bool all) const override;
 
+private:
+    /// Recompute the member offsets if the size of any type might have changed since
+    /// they were last computed.
+    void updateOffsets() const;
+
+    /// \returns the index of the member containing the bit at \p bitOffset,
+    /// or -1 if there is no such member.
+    int findMemberByOffset(uint64 bitOffset) const;
+
 private:
     std::vector<SharedType> m_types;
     std::vector<QString> m_names;
+
+    /// Offset in bits of each member, followed by the total size of the struct.
+    mutable std::vector<uint64> m_offsets;
+    mutable uint64 m_offsetsGeneration = static_cast<uint64>(-1);
 };
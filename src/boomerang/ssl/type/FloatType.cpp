@@ -46,6 +46,7 @@ Type::Size FloatType::getSize() const
 void FloatType::setSize(Type::Size sz)
 {
     m_size = sz;
+    invalidateSizes();
 }
 
 
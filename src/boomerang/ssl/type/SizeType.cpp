@@ -75,6 +75,7 @@ std::shared_ptr<SizeType> SizeType::get()
 void SizeType::setSize(Size sz)
 {
     m_size = sz;
+    invalidateSizes();
 }
 
 
@@ -42,6 +42,9 @@
 /// For NamedType
 static QMap<QString, SharedType> g_namedTypes;
 
+/// Incremented whenever the size of a type might have changed
+static uint64 g_sizeGeneration = 0;
+
 
 Type::Type(TypeClass _class)
     : m_id(_class)
@@ -96,6 +99,8 @@ void Type::addNamedType(const QString &name, SharedType type)
             g_namedTypes[name] = type->clone();
         }
     }
+
+    invalidateSizes();
 }
 
 
@@ -110,6 +115,19 @@ SharedType Type::getNamedType(const QString &name)
 void Type::clearNamedTypes()
 {
     g_namedTypes.clear();
+    invalidateSizes();
+}
+
+
+void Type::invalidateSizes()
+{
+    ++g_sizeGeneration;
+}
+
+
+uint64 Type::getSizeGeneration()
+{
+    return g_sizeGeneration;
 }
 
 
@@ -206,6 +206,13 @@ protected:
      */
     virtual bool isCompatible(const Type &other, bool all) const = 0;
 
+    /// Must be called whenever the size of an existing type might change,
+    /// so that cached sizes and member offsets of aggregate types are recomputed.
+    static void invalidateSizes();
+
+    /// \returns a counter that is incremented by each call to \ref invalidateSizes
+    static uint64 getSizeGeneration();
+
 protected:
     TypeClass m_id;
 };
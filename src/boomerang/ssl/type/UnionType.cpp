@@ -82,6 +82,10 @@ SharedType UnionType::clone() const
 
 Type::Size UnionType::getSize() const
 {
+    if (m_sizeGeneration == getSizeGeneration()) {
+        return m_size;
+    }
+
     Size max = 0;
 
     for (auto &[ty, name] : m_entries) {
@@ -89,7 +93,9 @@ Type::Size UnionType::getSize() const
         max = std::max(max, ty->getSize());
     }
 
-    return std::max(max, (Size)1);
+    m_size           = std::max(max, (Size)1);
+    m_sizeGeneration = getSizeGeneration();
+    return m_size;
 }
 
 
@@ -189,6 +195,8 @@ void UnionType::addType(SharedType newType, const QString &name)
         m_entries.insert({ newType, name });
         // TODO: update name if not inserted because of type clash
     }
+
+    invalidateSizes();
 }
 
 
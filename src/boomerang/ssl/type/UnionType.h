@@ -104,4 +104,8 @@ private:
 
 private:
     UnionEntries m_entries;
+
+    /// Cached result of \ref getSize, valid while m_sizeGeneration is the current size generation
+    mutable Size m_size             = 0;
+    mutable uint64 m_sizeGeneration = static_cast<uint64>(-1);
 };
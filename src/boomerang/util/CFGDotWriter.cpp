@@ -20,6 +20,8 @@
 #include "boomerang/ssl/exp/Exp.h"
 #include "boomerang/util/log/Log.h"
 
+#include <unordered_map>
+
 
 void CFGDotWriter::writeCFG(const Prog *prog, const QString &filename)
 {
@@ -29,6 +31,15 @@ void CFGDotWriter::writeCFG(const Prog *prog, const QString &filename)
         return;
     }
 
+    // Collect the basic blocks of all procs at once instead of scanning the whole
+    // low level CFG for every single proc
+    std::unordered_map<const UserProc *, std::vector<const BasicBlock *>> procBBs;
+    for (const BasicBlock *bb : *prog->getCFG()) {
+        if (bb && bb->getProc()) {
+            procBBs[bb->getProc()].push_back(bb);
+        }
+    }
+
     OStream of(&tgt);
     of << "digraph ProgCFG {\n";
 
@@ -50,7 +61,7 @@ void CFGDotWriter::writeCFG(const Prog *prog, const QString &filename)
             of << "\n";
 
             of << "    subgraph cluster_llcfg {\n";
-            writeCFG(p, of);
+            writeCFG(procBBs[p], of);
             of << "    }\n";
             of << "\n";
 
@@ -86,45 +97,39 @@ void CFGDotWriter::writeCFG(const ProcSet &procs, const QString &filename)
 }
 
 
-void CFGDotWriter::writeCFG(const UserProc *proc, OStream &of)
+void CFGDotWriter::writeCFG(const std::vector<const BasicBlock *> &bbs, OStream &of)
 {
-    const LowLevelCFG *cfg = proc->getProg()->getCFG();
-
-    for (const BasicBlock *bb : *cfg) {
-        if (bb && bb->getProc() == proc) {
-            of << "      bb" << bb->getLowAddr() << "[shape=rectangle, label=\"";
+    for (const BasicBlock *bb : bbs) {
+        of << "      bb" << bb->getLowAddr() << "[shape=rectangle, label=\"";
 
-            for (const MachineInstruction &insn : bb->getInsns()) {
-                of << insn.m_addr << "  " << insn.m_mnem.data() << " " << insn.m_opstr.data()
-                   << "\\l";
-            }
-
-            of << "\"];\n";
+        for (const MachineInstruction &insn : bb->getInsns()) {
+            of << insn.m_addr << "  " << insn.m_mnem.data() << " " << insn.m_opstr.data()
+               << "\\l";
         }
+
+        of << "\"];\n";
     }
 
     of << "\n";
 
     // edges
-    for (const BasicBlock *srcBB : *cfg) {
-        if (srcBB && srcBB->getProc() == proc) {
-            for (int j = 0; j < srcBB->getNumSuccessors(); j++) {
-                const BasicBlock *dstBB = srcBB->getSuccessor(j);
-
-                of << "      bb" << srcBB->getLowAddr() << " -> bb" << dstBB->getLowAddr();
-
-                if (srcBB->isType(BBType::Twoway)) {
-                    if (j == 0) {
-                        of << " [color=\"green\"];\n"; // cond == true
-                    }
-                    else {
-                        of << " [color=\"red\"];\n"; // cond == false
-                    }
+    for (const BasicBlock *srcBB : bbs) {
+        for (int j = 0; j < srcBB->getNumSuccessors(); j++) {
+            const BasicBlock *dstBB = srcBB->getSuccessor(j);
+
+            of << "      bb" << srcBB->getLowAddr() << " -> bb" << dstBB->getLowAddr();
+
+            if (srcBB->isType(BBType::Twoway)) {
+                if (j == 0) {
+                    of << " [color=\"green\"];\n"; // cond == true
                 }
                 else {
-                    of << " [color=\"black\"];\n"; // normal connection
+                    of << " [color=\"red\"];\n"; // cond == false
                 }
             }
+            else {
+                of << " [color=\"black\"];\n"; // normal connection
+            }
         }
     }
 
@@ -145,18 +150,20 @@ void CFGDotWriter::writeCFG(const ProcCFG *cfg, OStream &of)
         IRFragment::RTLIterator rit;
         StatementList::iterator sit;
 
+        // Print all statements of the fragment first and escape them all at once
+        QString str;
+        OStream temp(&str);
+
         for (SharedStmt stmt = frag->getFirstStmt(rit, sit); stmt;
              stmt            = frag->getNextStmt(rit, sit)) {
-            QString str;
-            OStream temp(&str);
             stmt->print(temp);
-            str.replace('\n', "\\l");
-            str.replace('%', "\\%");
-            str.replace('\"', "\\\"");
-            of << str << "\\l";
+            temp << "\n";
         }
 
-        of << "\"];\n";
+        str.replace('\n', "\\l");
+        str.replace('%', "\\%");
+        str.replace('\"', "\\\"");
+        of << str << "\"];\n";
     }
 
     of << "\n";
@@ -14,8 +14,10 @@
 #include "boomerang/db/proc/UserProc.h"
 
 #include <set>
+#include <vector>
 
 
+class BasicBlock;
 class Prog;
 class UserProc;
 class ProcCFG;
@@ -38,5 +40,6 @@ public:
 
 private:
     void writeCFG(const ProcCFG *cfg, OStream &os);
-    void writeCFG(const UserProc *proc, OStream &os);
+    /// Write the low level CFG consisting of the basic blocks in \p bbs
+    void writeCFG(const std::vector<const BasicBlock *> &bbs, OStream &os);
 };
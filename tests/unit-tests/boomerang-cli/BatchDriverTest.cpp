@@ -0,0 +1,39 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BatchDriverTest.h"
+
+
+#include "boomerang-cli/BatchDriver.h"
+
+
+void BatchDriverTest::testGetOutputDirNames()
+{
+    QCOMPARE(BatchDriver::getOutputDirNames({}), QStringList());
+
+    QCOMPARE(BatchDriver::getOutputDirNames({ "/tmp/a/foo.exe", "/tmp/a/bar.exe" }),
+             QStringList({ "foo.exe", "bar.exe" }));
+
+    // same base name
+    QCOMPARE(BatchDriver::getOutputDirNames({ "/tmp/a/foo.exe", "/tmp/a/foo.dll" }),
+             QStringList({ "foo.exe", "foo.dll" }));
+
+    // same file name in different directories
+    QCOMPARE(
+        BatchDriver::getOutputDirNames({ "/tmp/a/foo.exe", "/tmp/b/foo.exe", "/tmp/c/FOO.EXE" }),
+        QStringList({ "foo.exe", "foo.exe_2", "FOO.EXE_3" }));
+
+    // a program whose file name is a generated name
+    QCOMPARE(
+        BatchDriver::getOutputDirNames({ "/tmp/a/foo.exe", "/tmp/b/foo.exe", "/tmp/foo.exe_2" }),
+        QStringList({ "foo.exe", "foo.exe_2", "foo.exe_2_2" }));
+}
+
+
+QTEST_GUILESS_MAIN(BatchDriverTest)
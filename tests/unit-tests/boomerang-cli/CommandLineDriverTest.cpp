@@ -389,4 +389,42 @@ void CommandLineDriverTest::testApplyCommandline()
 }
 
 
+void CommandLineDriverTest::testBatchWorkerArgs()
+{
+    {
+        CommandlineDriver drv;
+        QCOMPARE(drv.applyCommandline({ "boomerang-cli", "--batch", "list.txt" }), 0);
+        QCOMPARE(drv.getBatchWorkerArgs(), QStringList());
+    }
+
+    {
+        CommandlineDriver drv;
+        QCOMPARE(drv.applyCommandline({ "boomerang-cli", "-v", "--batch", "list.txt", "-j", "4",
+                                        "-o", "out", "-nT", "-l", "10" }),
+                 0);
+        QCOMPARE(drv.getBatchWorkerArgs(), QStringList({ "-v", "-nT", "-l", "10" }));
+        QCOMPARE(drv.getProject()->getSettings()->getOutputDirectory(), QString("out/"));
+    }
+
+    {
+        // the values of the batch switches must not be taken for other switches
+        CommandlineDriver drv;
+        QCOMPARE(drv.applyCommandline({ "boomerang-cli", "-o", "-v", "-j", "2", "--batch", "-nT" }),
+                 0);
+        QCOMPARE(drv.getBatchWorkerArgs(), QStringList());
+    }
+
+    {
+        CommandlineDriver drv;
+        QCOMPARE(drv.applyCommandline({ "boomerang-cli", "--batch", "list.txt", "test.exe" }), 1);
+    }
+
+    {
+        CommandlineDriver drv;
+        QCOMPARE(drv.applyCommandline({ "boomerang-cli", "-j", "0", "--batch", "list.txt" }), 1);
+        QCOMPARE(drv.applyCommandline({ "boomerang-cli", "--batch" }), 1);
+    }
+}
+
+
 QTEST_GUILESS_MAIN(CommandLineDriverTest)
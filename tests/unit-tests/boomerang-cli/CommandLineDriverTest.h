@@ -20,5 +20,6 @@ class CommandLineDriverTest : public BoomerangTest
 private slots:
     void initTestCase();
     void testApplyCommandline();
+    void testBatchWorkerArgs();
 };
 
@@ -54,6 +54,34 @@ void CapstonePPCDecoderTest::testInstructions()
 }
 
 
+void CapstonePPCDecoderTest::testDisassembleBlock()
+{
+    // add r0, r1, r2; blr; add r0, r1, r2
+    const Byte insnData[] = "\x7c\x01\x12\x14\x4e\x80\x00\x20\x7c\x01\x12\x14";
+
+    const Address sourceAddr = Address(0x1000);
+    const ptrdiff_t diff     = (HostAddress(insnData) - sourceAddr).value();
+
+    {
+        // stop after the return
+        std::vector<MachineInstruction> insns;
+        QVERIFY(m_decoder->disassembleBlock(sourceAddr, Address(0x100C), diff, insns));
+        QCOMPARE(insns.size(), std::size_t(2));
+        QCOMPARE(insns[0].m_addr, Address(0x1000));
+        QCOMPARE(insns[1].m_addr, Address(0x1004));
+        QVERIFY(insns[1].isInGroup(MIGroup::Ret));
+    }
+
+    {
+        // stop at the limit
+        std::vector<MachineInstruction> insns;
+        QVERIFY(m_decoder->disassembleBlock(sourceAddr, Address(0x1004), diff, insns));
+        QCOMPARE(insns.size(), std::size_t(1));
+        QVERIFY(!insns[0].isCTI());
+    }
+}
+
+
 void CapstonePPCDecoderTest::testInstructions_data()
 {
     QTest::addColumn<InstructionData>("insnData");
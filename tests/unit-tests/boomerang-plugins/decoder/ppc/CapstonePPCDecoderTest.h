@@ -23,6 +23,8 @@ private slots:
     void testInstructions();
     void testInstructions_data();
 
+    void testDisassembleBlock();
+
 private:
     IDecoder *m_decoder;
 };
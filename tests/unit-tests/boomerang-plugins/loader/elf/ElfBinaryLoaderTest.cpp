@@ -60,6 +60,21 @@ void ElfBinaryLoaderTest::testElfLoadClang()
 }
 
 
+void ElfBinaryLoaderTest::testRelocations()
+{
+    QVERIFY(m_project.loadBinaryFile(HELLO_CLANG4));
+    BinaryFile *binary = m_project.getLoadedBinaryFile();
+    QVERIFY(binary != nullptr);
+
+    QVERIFY(binary->isRelocationAt(Address(0x08049FFC))); // .rel.dyn: __gmon_start__
+    QVERIFY(binary->isRelocationAt(Address(0x0804A00C))); // .rel.plt: printf
+    QVERIFY(binary->isRelocationAt(Address(0x0804A010))); // .rel.plt: __libc_start_main
+
+    QVERIFY(!binary->isRelocationAt(Address(0x0804A008)));
+    QVERIFY(!binary->isRelocationAt(binary->getMainEntryPoint()));
+}
+
+
 void ElfBinaryLoaderTest::testLoadSolaris()
 {
     // Load x86 hello world
@@ -22,6 +22,9 @@ private slots:
     /// compiled with clang-4.0.0 (without debug info)
     void testElfLoadClang();
 
+    /// Test that the destinations of .rel.dyn and .rel.plt entries are recorded
+    void testRelocations();
+
     /// Test loading the x86 (Solaris) hello world program
     void testLoadSolaris();
     void testLoadSolaris_data();
@@ -30,4 +30,24 @@ void Win32BinaryLoaderTest::testWinLoad()
 }
 
 
+void Win32BinaryLoaderTest::testRelocations()
+{
+    QVERIFY(m_project.loadBinaryFile(SWITCH_BORLAND));
+    BinaryFile *binary = m_project.getLoadedBinaryFile();
+    QVERIFY(binary != nullptr);
+
+    // first and last entries of the .reloc section
+    QVERIFY(binary->isRelocationAt(Address(0x00401BC3)));
+    QVERIFY(binary->isRelocationAt(Address(0x00401BC9)));
+    QVERIFY(binary->isRelocationAt(Address(0x0040E00C)));
+
+    QVERIFY(!binary->isRelocationAt(Address(0x00401BC4)));
+    QVERIFY(!binary->isRelocationAt(binary->getMainEntryPoint()));
+
+    // files without a .reloc section do not have any relocations
+    QVERIFY(m_project.loadBinaryFile(getFullSamplePath("windows/hello.exe")));
+    QVERIFY(!m_project.getLoadedBinaryFile()->isRelocationAt(Address(0x00401BC3)));
+}
+
+
 QTEST_GUILESS_MAIN(Win32BinaryLoaderTest)
@@ -20,4 +20,7 @@ class Win32BinaryLoaderTest : public BoomerangTestWithPlugins
 private slots:
     /// Test loading Windows programs
     void testWinLoad();
+
+    /// Test that IMAGE_REL_BASED_HIGHLOW base relocations are recorded
+    void testRelocations();
 };
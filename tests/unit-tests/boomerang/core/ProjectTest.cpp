@@ -34,6 +34,27 @@ void ProjectTest::testLoadBinaryFile()
 }
 
 
+void ProjectTest::testLazyPluginInit()
+{
+    Project project;
+    project.getSettings()->setDataDirectory(BOOMERANG_TEST_BASE "share/boomerang/");
+    project.getSettings()->setPluginDirectory(BOOMERANG_TEST_BASE "lib/boomerang/plugins/");
+    project.loadPlugins();
+
+    PluginManager *pm = project.getPluginManager();
+    QVERIFY(pm->getPluginByName("Capstone x86 decoder plugin") != nullptr);
+    QVERIFY(pm->getPluginByName("Capstone PPC decoder plugin") != nullptr);
+    QVERIFY(!pm->getPluginByName("Capstone x86 decoder plugin")->isInitialized());
+    QVERIFY(!pm->getPluginByName("Capstone PPC decoder plugin")->isInitialized());
+
+    QVERIFY(project.loadBinaryFile(getFullSamplePath("elf/hello-clang4-dynamic")));
+    QVERIFY(pm->getPluginByName("X86 FrontEnd plugin")->isInitialized());
+    QVERIFY(pm->getPluginByName("Capstone x86 decoder plugin")->isInitialized());
+    QVERIFY(!pm->getPluginByName("Capstone PPC decoder plugin")->isInitialized());
+    QVERIFY(!pm->getPluginByName("PPC FrontEnd plugin")->isInitialized());
+}
+
+
 void ProjectTest::testLoadSaveFile()
 {
     Project project;
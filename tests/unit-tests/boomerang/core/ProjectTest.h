@@ -24,6 +24,9 @@ private slots:
     /// Test the import binary function.
     void testLoadBinaryFile();
 
+    /// Test that only the plugins required for the loaded binary are initialized.
+    void testLazyPluginInit();
+
     // test loading/writing to/from a save file
     void testLoadSaveFile();
     void testWriteSaveFile();
@@ -19,6 +19,7 @@
 #include "boomerang/ssl/type/ArrayType.h"
 #include "boomerang/ssl/type/IntegerType.h"
 #include "boomerang/ssl/type/FloatType.h"
+#include "boomerang/ssl/type/NamedType.h"
 #include "boomerang/ssl/type/PointerType.h"
 #include "boomerang/ssl/type/SizeType.h"
 #include "boomerang/ssl/type/VoidType.h"
@@ -159,4 +160,30 @@ void GlobalTest::testReadInitialValue()
 }
 
 
+void GlobalTest::testGetInitialIntArray()
+{
+    QVERIFY(m_project.loadBinaryFile(SAMPLE("x86/sumarray")));
+    Prog *prog = m_project.getProg();
+
+    InitialIntArray array;
+    Global intArrGlob(ArrayType::get(IntegerType::get(32), 10), Address(0x08049460), "", prog);
+    QVERIFY(intArrGlob.getInitialIntArray(array));
+    QCOMPARE(array.numElements, 10);
+    QCOMPARE(array.elementSize, 4);
+    QCOMPARE(Util::readDWord(array.data, array.endian), DWord(1));
+    QCOMPARE(Util::readDWord(array.data + 36, array.endian), DWord(10));
+
+    // Named types are declared by name, not as arrays
+    Type::addNamedType("intarray_t", ArrayType::get(IntegerType::get(32), 10));
+    Global namedArrGlob(NamedType::get("intarray_t"), Address(0x08049460), "", prog);
+    QVERIFY(!namedArrGlob.getInitialIntArray(array));
+
+    Global charArrGlob(ArrayType::get(CharType::get(), 10), Address(0x08049460), "", prog);
+    QVERIFY(!charArrGlob.getInitialIntArray(array));
+
+    Global intGlob(IntegerType::get(32), Address(0x08049460), "", prog);
+    QVERIFY(!intGlob.getInitialIntArray(array));
+}
+
+
 QTEST_GUILESS_MAIN(GlobalTest)
@@ -21,4 +21,5 @@ private slots:
     void testContainsAddress();
     void testGetInitialValue();
     void testReadInitialValue();
+    void testGetInitialIntArray();
 };
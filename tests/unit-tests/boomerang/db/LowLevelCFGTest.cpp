@@ -216,6 +216,26 @@ void LowLevelCFGTest::testIsStartOfCompleteBB()
 }
 
 
+void LowLevelCFGTest::testGetNextBBStartAfter()
+{
+    {
+        LowLevelCFG cfg;
+        QCOMPARE(cfg.getNextBBStartAfter(Address(0x1000)), Address::INVALID);
+    }
+
+    {
+        LowLevelCFG cfg;
+        cfg.createBB(BBType::Fall, createInsns(Address(0x1000), 2));
+        cfg.createIncompleteBB(Address(0x2000));
+
+        QCOMPARE(cfg.getNextBBStartAfter(Address(0x0800)), Address(0x1000));
+        QCOMPARE(cfg.getNextBBStartAfter(Address(0x1000)), Address(0x2000));
+        QCOMPARE(cfg.getNextBBStartAfter(Address(0x1001)), Address(0x2000));
+        QCOMPARE(cfg.getNextBBStartAfter(Address(0x2000)), Address::INVALID);
+    }
+}
+
+
 void LowLevelCFGTest::testRemoveBB()
 {
     {
@@ -27,6 +27,7 @@ private slots:
     void testGetBBStartingAt();
     void testIsStartOfBB();
     void testIsStartOfCompleteBB();
+    void testGetNextBBStartAfter();
     void testRemoveBB();
     void testAddEdge();
     void testIsWellFormed();
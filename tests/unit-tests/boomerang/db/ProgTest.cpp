@@ -344,6 +344,26 @@ void ProgTest::testGetFloatConstant()
 }
 
 
+void ProgTest::testGetFormatStringArgTypes()
+{
+    Prog testProg("test", nullptr);
+
+    const std::vector<SharedType> &printfTypes = testProg.getFormatStringArgTypes("%d %s", false);
+    QCOMPARE(printfTypes.size(), size_t(2));
+    QCOMPARE(printfTypes[0]->toString(), IntegerType::get(32, Sign::Signed)->toString());
+    QCOMPARE(printfTypes[1]->toString(), PointerType::get(ArrayType::get(CharType::get()))->toString());
+
+    // parsed only once
+    QVERIFY(&testProg.getFormatStringArgTypes("%d %s", false) == &printfTypes);
+
+    // scanf style format strings are cached separately
+    const std::vector<SharedType> &scanfTypes = testProg.getFormatStringArgTypes("%d %s", true);
+    QVERIFY(&scanfTypes != &printfTypes);
+    QCOMPARE(scanfTypes.size(), size_t(2));
+    QCOMPARE(scanfTypes[0]->toString(), PointerType::get(IntegerType::get(32, Sign::Signed))->toString());
+}
+
+
 void ProgTest::testGetSymbolNameByAddr()
 {
     QVERIFY(m_project.loadBinaryFile(HELLO_X86));
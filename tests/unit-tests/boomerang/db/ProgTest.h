@@ -48,6 +48,7 @@ private slots:
 
     void testGetStringConstant();
     void testGetFloatConstant();
+    void testGetFormatStringArgTypes();
     void testGetSymbolNameByAddr();
     void testGetSectionByAddr();
     void testGetLimitText();
@@ -0,0 +1,31 @@
+#pragma region License
+/*
+ * This file is part of the Boomerang Decompiler.
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ */
+#pragma endregion License
+#include "BinaryFileTest.h"
+
+
+#include "boomerang/db/binary/BinaryFile.h"
+
+#include <QByteArray>
+
+
+void BinaryFileTest::testIsRelocationAt()
+{
+    BinaryFile file(QByteArray(), nullptr);
+    QVERIFY(!file.isRelocationAt(Address(0x1000)));
+
+    file.addRelocation(Address(0x1000));
+    file.addRelocation(Address(0x1008));
+    QVERIFY(file.isRelocationAt(Address(0x1000)));
+    QVERIFY(!file.isRelocationAt(Address(0x1004)));
+    QVERIFY(file.isRelocationAt(Address(0x1008)));
+}
+
+
+QTEST_GUILESS_MAIN(BinaryFileTest)
@@ -104,6 +104,36 @@ void BinaryImageTest::testGetSectionByAddr()
 }
 
 
+void BinaryImageTest::testFreeze()
+{
+    BinaryImage img(QByteArray{});
+    img.freeze();
+    QVERIFY(img.isFrozen());
+    QVERIFY(img.getSectionByAddr(Address(0x1000)) == nullptr);
+
+    img.reset();
+    QVERIFY(!img.isFrozen());
+
+    BinarySection *sect1 = img.createSection("sect1", Address(0x1000), Address(0x2000));
+    BinarySection *sect2 = img.createSection("sect2", Address(0x3000), Address(0x4000));
+    BinarySection *sect3 = img.createSection(".tbss", Address(0x3800), Address(0x5000));
+    QVERIFY(sect1 && sect2 && sect3);
+
+    img.freeze();
+    QVERIFY(img.getSectionByAddr(Address(0x0FFF)) == nullptr);
+    QVERIFY(img.getSectionByAddr(Address(0x1000)) == sect1);
+    QVERIFY(img.getSectionByAddr(Address(0x1FFF)) == sect1);
+    QVERIFY(img.getSectionByAddr(Address(0x2000)) == nullptr);
+    QVERIFY(img.getSectionByAddr(Address(0x3800)) == sect2); // overlap: lowest lower bound
+    QVERIFY(img.getSectionByAddr(Address(0x4000)) == sect3);
+    QVERIFY(img.getSectionByAddr(Address(0x5000)) == nullptr);
+
+    // frozen images cannot be modified
+    QVERIFY(img.createSection("sect4", Address(0x6000), Address(0x7000)) == nullptr);
+    QVERIFY(!img.writeNative4(Address(0x1000), 0x12345678));
+}
+
+
 void BinaryImageTest::testUpdateTextLimits()
 {
     BinaryImage img(QByteArray{});
@@ -24,6 +24,7 @@ private slots:
     void testGetSectionByIndex();
     void testGetSectionByName();
     void testGetSectionByAddr();
+    void testFreeze();
 
     void testUpdateTextLimits();
 
@@ -77,6 +77,21 @@ void BinarySymbolTableTest::testFindSymbolByAddress()
 }
 
 
+void BinarySymbolTableTest::testGetAddrIndex()
+{
+    BinarySymbolTable tbl;
+    QVERIFY(tbl.getAddrIndex().empty());
+
+    BinarySymbol *sym = tbl.createSymbol(Address(0x1000), "testSym");
+    tbl.createSymbol(Address(0x2000), "testSym"); // redirected to sym
+
+    QCOMPARE(tbl.size(), 1);
+    QCOMPARE(tbl.getAddrIndex().size(), static_cast<size_t>(2));
+    QVERIFY(tbl.getAddrIndex().at(Address(0x1000)).get() == sym);
+    QVERIFY(tbl.getAddrIndex().at(Address(0x2000)).get() == sym);
+}
+
+
 void BinarySymbolTableTest::testFindSymbolByName()
 {
     BinarySymbolTable tbl;
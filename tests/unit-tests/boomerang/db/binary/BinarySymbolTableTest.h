@@ -24,6 +24,7 @@ private slots:
 
     void testCreateSymbol();
     void testFindSymbolByAddress();
+    void testGetAddrIndex();
     void testFindSymbolByName();
     void testRenameSymbol();
 };
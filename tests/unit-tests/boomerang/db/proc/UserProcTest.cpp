@@ -190,6 +190,55 @@ void UserProcTest::testInsertStatementAfter()
 }
 
 
+void UserProcTest::testInsertStatementsAfter()
+{
+    Prog prog("test", nullptr);
+    BasicBlock *bb1 = prog.getCFG()->createBB(BBType::Oneway, createInsns(Address(0x1000), 1));
+
+    {
+        UserProc proc(Address(0x1000), "test", nullptr);
+
+        std::unique_ptr<RTLList> bbRTLs(new RTLList);
+        bbRTLs->push_back(std::unique_ptr<RTL>(new RTL(Address(0x1000), { })));
+        IRFragment *entryFrag = proc.getCFG()->createFragment(FragType::Oneway, std::move(bbRTLs), bb1);
+        proc.setEntryFragment();
+
+        std::shared_ptr<Assign> as1 = proc.insertAssignAfter(nullptr, Location::regOf(REG_X86_EAX), Location::regOf(REG_X86_ECX));
+        std::shared_ptr<Assign> as2 = proc.insertAssignAfter(as1, Location::regOf(REG_X86_EBX), Location::regOf(REG_X86_EDX));
+
+        std::shared_ptr<Assign> new1(new Assign(VoidType::get(), Location::regOf(REG_X86_EDX), Location::regOf(REG_X86_EBX)));
+        std::shared_ptr<Assign> new2(new Assign(VoidType::get(), Location::regOf(REG_X86_ESI), Location::regOf(REG_X86_EDI)));
+        std::shared_ptr<Assign> new3(new Assign(VoidType::get(), Location::regOf(REG_X86_EDI), Location::regOf(REG_X86_ESI)));
+
+        UserProc::StmtInsertionMap insertions;
+        insertions[as1] = { new1, new2 };
+        insertions[as2] = { new3 };
+
+        QVERIFY(proc.insertStatementsAfter(insertions));
+        QVERIFY(new1->getFragment() == entryFrag);
+        QVERIFY(new3->getFragment() == entryFrag);
+
+        const RTL *rtl = proc.getEntryFragment()->getRTLs()->front().get();
+        QCOMPARE(rtl->size(), static_cast<std::size_t>(5));
+
+        auto it = rtl->begin();
+        QVERIFY(*it++ == as1);
+        QVERIFY(*it++ == new1);
+        QVERIFY(*it++ == new2);
+        QVERIFY(*it++ == as2);
+        QVERIFY(*it++ == new3);
+
+        // anchor not in the proc
+        std::shared_ptr<Assign> notInProc(new Assign(VoidType::get(), Location::regOf(REG_X86_EAX), Location::regOf(REG_X86_EAX)));
+        notInProc->setFragment(entryFrag);
+        insertions.clear();
+        insertions[notInProc] = { new1->clone() };
+        QVERIFY(!proc.insertStatementsAfter(insertions));
+        QCOMPARE(rtl->size(), static_cast<std::size_t>(5));
+    }
+}
+
+
 void UserProcTest::testReplacePhiByAssign()
 {
     Prog prog("test", nullptr);
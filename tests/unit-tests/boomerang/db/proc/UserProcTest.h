@@ -22,6 +22,7 @@ private slots:
     void testRemoveStatement();
     void testInsertAssignAfter();
     void testInsertStatementAfter();
+    void testInsertStatementsAfter();
     void testReplacePhiByAssign();
 
     void testAddParameterToSignature();
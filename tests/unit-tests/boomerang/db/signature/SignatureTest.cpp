@@ -353,6 +353,13 @@ void SignatureTest::testIsAddrOfStackLocal()
     SharedExp spMinusPi = Binary::get(opMinus, Location::regOf(REG_X86_ESP), Const::get(3.14156));
     QVERIFY(!sig.isAddrOfStackLocal(REG_X86_ESP, spMinusPi));
 
+    SharedExp spPlus0 = Binary::get(opPlus, Location::regOf(REG_X86_ESP), Const::get(0));
+    QVERIFY(!sig.isAddrOfStackLocal(REG_X86_ESP, spPlus0));
+
+    // (sp - 8) + 4 == sp - 4
+    SharedExp spMinus8Plus4 = Binary::get(opPlus, Binary::get(opMinus, Location::regOf(REG_X86_ESP), Const::get(8)), Const::get(4));
+    QVERIFY(sig.isAddrOfStackLocal(REG_X86_ESP, spMinus8Plus4));
+
     // m[sp{4} - 10] is not a stack local
     std::shared_ptr<Assign> asgn(new Assign(Location::regOf(REG_X86_ESP), Location::regOf(REG_X86_EAX)));
     asgn->setNumber(4);
@@ -24,6 +24,15 @@ void RegDBTest::testClear()
     db.clear();
     QVERIFY(!db.isRegDefined("%ax"));
     QVERIFY(!db.isRegNumDefined(REG_X86_AX));
+
+    // relations must be removed as well
+    QVERIFY(db.createReg(RegType::Int, REG_X86_EAX, "%eax", 32));
+    QVERIFY(db.createReg(RegType::Int, REG_X86_AX, "%ax", 16));
+    QVERIFY(db.createRegRelation("%eax", "%ax", 0));
+    db.clear();
+    QVERIFY(db.createReg(RegType::Int, REG_X86_EAX, "%eax", 32));
+    QVERIFY(db.createReg(RegType::Int, REG_X86_AX, "%ax", 16));
+    QVERIFY(db.createRegRelation("%eax", "%ax", 0));
 }
 
 
@@ -168,6 +177,7 @@ void RegDBTest::testCreateRegRelation()
     QVERIFY( db.createRegRelation("%bar", "%bar_lo", 0));
     QVERIFY( db.createRegRelation("%bar", "%bar_hi", 16));      // non-zero offset
     QVERIFY(!db.createRegRelation("%bar", "%bar_hi", 16));      // cannot have same relation twice
+    QVERIFY(!db.createRegRelation("%foo2", "%foo", 0));         // cannot relate aliases
 
     QVERIFY(db.createReg(RegType::Int, RegNum(10), "%eip", 32));
     QVERIFY(db.createReg(RegType::Int, RegNum(11), "%ip", 16));
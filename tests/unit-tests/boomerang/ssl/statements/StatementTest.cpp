@@ -81,6 +81,96 @@ void StatementTest::testFragment()
 }
 
 
+void StatementTest::testID()
+{
+    UserProc proc1(Address(0x1000), "test1", nullptr);
+    UserProc proc2(Address(0x2000), "test2", nullptr);
+
+    SharedStmt a1(new Assign(Location::regOf(REG_X86_EAX), Const::get(1)));
+    SharedStmt b1(new Assign(Location::regOf(REG_X86_EAX), Const::get(2)));
+    SharedStmt a2(new Assign(Location::regOf(REG_X86_ECX), Const::get(3)));
+    SharedStmt b2(new Assign(Location::regOf(REG_X86_ECX), Const::get(4)));
+
+    // interleave the procs; the IDs must not depend on it
+    a2->setProc(&proc2);
+    a1->setProc(&proc1);
+    b2->setProc(&proc2);
+    b1->setProc(&proc1);
+
+    QCOMPARE(a1->getID(), 0U);
+    QCOMPARE(b1->getID(), 1U);
+    QCOMPARE(a2->getID(), 0U);
+    QCOMPARE(b2->getID(), 1U);
+
+    // ordered by proc, then by ID (use SharedStmt, since Assignment hides Statement::operator<)
+    QVERIFY(*a1 < *b1);
+    QVERIFY(*b1 < *a2);
+    QVERIFY(*a2 < *b2);
+    QVERIFY(!(*b2 < *a1));
+    QVERIFY(*a1 == *a1);
+    QVERIFY(!(*a1 == *a2));
+
+    // the ID does not change when the statement is moved to another proc
+    b1->setProc(&proc2);
+    QCOMPARE(b1->getID(), 1U);
+    QVERIFY(*b1 < *a2);
+
+    // copies get a new ID from the same proc
+    SharedStmt c2 = b2->clone();
+    QCOMPARE(c2->getProc(), &proc2);
+    QCOMPARE(c2->getID(), 2U);
+    QVERIFY(*b2 < *c2);
+
+    // statements without a proc are ordered after statements of a proc
+    SharedStmt noProc(new Assign(Location::regOf(REG_X86_EDX), Const::get(5)));
+    QVERIFY(*c2 < *noProc);
+    QVERIFY(!(*noProc == *a1));
+}
+
+
+void StatementTest::testNumberAddedStatement()
+{
+    QVERIFY(m_project.loadBinaryFile(HELLO_X86));
+    QVERIFY(m_project.decodeBinaryFile());
+
+    UserProc *proc = static_cast<UserProc *>(
+        m_project.getProg()->getFunctionByAddr(Address(0x08048328)));
+    QVERIFY(proc != nullptr && !proc->isLib());
+
+    proc->numberStatements();
+
+    StatementList stmts;
+    proc->getStatements(stmts);
+    QVERIFY(!stmts.empty());
+    QCOMPARE(stmts.front()->getNumber(), 1);
+
+    int maxNumber = 0;
+    for (const SharedStmt &stmt : stmts) {
+        maxNumber = std::max(maxNumber, stmt->getNumber());
+    }
+
+    std::shared_ptr<Assign> asgn = proc->insertAssignAfter(nullptr, Location::regOf(REG_X86_EAX),
+                                                           Const::get(0));
+    QVERIFY(asgn != nullptr);
+    QVERIFY(asgn->getNumber() > maxNumber);
+
+    std::shared_ptr<Assign> asgn2(new Assign(Location::regOf(REG_X86_ECX), Const::get(0)));
+    asgn2->setProc(proc);
+    QVERIFY(asgn2->getNumber() > asgn->getNumber());
+
+    // numbering again numbers the statements in CFG order
+    proc->numberStatements();
+
+    stmts.clear();
+    proc->getStatements(stmts);
+
+    int expectedNumber = 1;
+    for (const SharedStmt &stmt : stmts) {
+        QCOMPARE(stmt->getNumber(), expectedNumber++);
+    }
+}
+
+
 void StatementTest::testIsNull()
 {
     {
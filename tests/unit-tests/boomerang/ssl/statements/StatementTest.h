@@ -23,6 +23,13 @@ class StatementTest : public BoomerangTestWithPlugins
 
 private slots:
     void testFragment();
+
+    /// Test that statement IDs and ordering only depend on the proc of the statements
+    void testID();
+
+    /// Test that statements added to a proc are numbered without renumbering the proc
+    void testNumberAddedStatement();
+
     void testIsNull();
     void testCanPropagateToExp();
     void testCanPropagateToExp_data();
@@ -206,6 +206,38 @@ void CompoundTypeTest::testGetOffsetRemainder()
 }
 
 
+void CompoundTypeTest::testMemberSizeChanged()
+{
+    auto intTy = IntegerType::get(32, Sign::Signed);
+    auto inner = CompoundType::get();
+    inner->addMember(intTy, "a");
+
+    CompoundType ct1;
+    ct1.addMember(inner, "inner");
+    ct1.addMember(FloatType::get(32), "foo");
+
+    QCOMPARE(ct1.getSize(), 64);
+    QCOMPARE(ct1.getMemberOffsetByName("foo"), 32);
+    QCOMPARE(ct1.getMemberNameByOffset(40), QString("foo"));
+
+    intTy->setSize(16);
+    QCOMPARE(ct1.getSize(), 48);
+    QCOMPARE(ct1.getMemberOffsetByName("foo"), 16);
+    QCOMPARE(ct1.getMemberNameByOffset(40), QString("foo"));
+    QCOMPARE(ct1.getOffsetRemainder(40), 24);
+
+    inner->addMember(IntegerType::get(16, Sign::Signed), "b");
+    QCOMPARE(ct1.getSize(), 64);
+    QCOMPARE(ct1.getMemberOffsetByIdx(1), 32);
+    QCOMPARE(ct1.getMemberNameByOffset(16), QString("inner"));
+
+    UnionType uty({ inner, FloatType::get(32) });
+    QCOMPARE(uty.getSize(), 32);
+    intTy->setSize(64);
+    QCOMPARE(uty.getSize(), 80);
+}
+
+
 void CompoundTypeTest::testIsCompatibleWith()
 {
     auto ct1 = CompoundType::get();
@@ -27,5 +27,6 @@ private slots:
     void testMemberName();
     void testMemberOffset();
     void testGetOffsetRemainder();
+    void testMemberSizeChanged();
     void testIsCompatibleWith();
 };